@@ -0,0 +1,114 @@
+/*
+===============================================================================
+BENCH INDEXED LOOKUP  String-keyed vs integer-tuple IndexedVariableSet lookup
+===============================================================================
+
+OVERVIEW
+--------
+Compares 10^7 random (i, j) lookups against:
+ Legacy    ostringstream key + std::unordered_map<std::string, size_t>
+              (the scheme IndexedVariableSet used before TupleIndex)
+ Current   IndexedVariableSet::at(i, j) through dsl::TupleIndex
+
+Both tables index the same 300 x 300 domain, and both loops visit the same
+pseudo-random key sequence. A checksum is printed so the work cannot be
+optimized away.
+
+BUILD / RUN
+-----------
+    cmake -DDSL_BUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release ..
+    cmake --build . --target bench_indexed_lookup
+    ./bench_indexed_lookup [lookups]
+
+===============================================================================
+*/
+
+#include <gurobi_dsl/variables.h>
+#include <gurobi_dsl/indexing.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    constexpr int N = 300;
+
+    /// Key format used by the previous string-keyed implementation
+    std::string legacyKey(int i, int j) {
+        std::ostringstream oss;
+        oss << static_cast<long long>(i) << '_' << static_cast<long long>(j);
+        return oss.str();
+    }
+
+    template<typename Fn>
+    double timeMs(Fn&& fn) {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t lookups = argc > 1
+        ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10))
+        : 10'000'000;
+
+    GRBEnv env(true);
+    env.set(GRB_IntParam_OutputFlag, 0);
+    env.start();
+    GRBModel model(env);
+
+    auto I = dsl::range(0, N);
+    auto X = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 1, "X", I * I);
+    model.update();
+
+    std::unordered_map<std::string, std::size_t> legacy;
+    legacy.reserve(X.size());
+    std::size_t pos = 0;
+    for (const auto& e : X) {
+        legacy.emplace(legacyKey(e.index[0], e.index[1]), pos++);
+    }
+
+    // Same pseudo-random key sequence for both runs
+    std::vector<std::pair<int, int>> keys(1 << 16);
+    std::uint64_t state = 0x2545F4914F6CDD1Dull;
+    for (auto& k : keys) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        k = { static_cast<int>((state >> 33) % N), static_cast<int>((state >> 13) % N) };
+    }
+    const std::size_t mask = keys.size() - 1;
+
+    std::size_t legacySum = 0;
+    const double legacyMs = timeMs([&] {
+        for (std::size_t n = 0; n < lookups; ++n) {
+            const auto [i, j] = keys[n & mask];
+            legacySum += legacy.find(legacyKey(i, j))->second;
+        }
+    });
+
+    std::size_t tupleSum = 0;
+    const double tupleMs = timeMs([&] {
+        for (std::size_t n = 0; n < lookups; ++n) {
+            const auto [i, j] = keys[n & mask];
+            tupleSum += static_cast<std::size_t>(X.at(i, j).index());
+        }
+    });
+
+    std::cout << "lookups: " << lookups << " over " << X.size() << " entries\n"
+              << "legacy string key : " << legacyMs << " ms ("
+              << legacyMs * 1e6 / static_cast<double>(lookups) << " ns/lookup)\n"
+              << "tuple index       : " << tupleMs << " ms ("
+              << tupleMs * 1e6 / static_cast<double>(lookups) << " ns/lookup)\n"
+              << "speedup           : " << legacyMs / tupleMs << "x\n"
+              << "checksums         : " << legacySum << " / " << tupleSum << "\n";
+
+    return legacySum == tupleSum ? 0 : 1;
+}
@@ -45,6 +45,7 @@ DSL FEATURES DEMONSTRATED
 - Triple-indexed variables       x[i,j,k]
 - MTZ subtour elimination        Miller-Tucker-Zemlin constraints
 - Complex filtered domains       Valid arcs and vehicle assignments
+- Sparse arc relation            dsl::Relation<2> with O(deg) out()/in() slices
 - Symmetry breaking              Order vehicles by first customer
 - Multiple constraint families   Flow, capacity, subtour
 - Large-scale modeling           Many variables and constraints
@@ -77,6 +78,7 @@ private:
     int nVehicles_;
     
     int nNodes_;  // Including depot
+    dsl::Relation<2> arcs_;  // Valid arcs (i, j), i != j, with adjacency slices
 
 public:
     VRPBuilder(
@@ -89,6 +91,13 @@ public:
         vehicleCapacity_(vehicleCapacity), nVehicles_(nVehicles),
         nNodes_(static_cast<int>(nodeNames.size()))
     {
+        // Materialize the arc set once; constraints then walk out()/in()
+        // slices instead of re-scanning all n^2 pairs
+        auto N = dsl::range(0, nNodes_);
+        arcs_ = dsl::Relation<2>::from((N * N) | dsl::filter([](int i, int j) {
+            return i != j;
+        }));
+
         store()["n_nodes"] = nNodes_;
         store()["n_customers"] = nNodes_ - 1;
         store()["n_vehicles"] = nVehicles_;
@@ -144,12 +153,10 @@ protected:
             model(), "visit", C,
             [&](int i) {
                 GRBLinExpr lhs = 0;
-                for (int j : N) {
-                    if (i != j) {
-                        for (int k : K) {
-                            auto* var = X.asIndexed().try_get(i, j, k);
-                            if (var) lhs += *var;
-                        }
+                for (int j : arcs_.out(i)) {
+                    for (int k : K) {
+                        auto* var = X.asIndexed().try_get(i, j, k);
+                        if (var) lhs += *var;
                     }
                 }
                 return lhs == 1;
@@ -163,13 +170,13 @@ protected:
             model(), "flow", flowDomain,
             [&](int j, int k) {
                 GRBLinExpr inFlow = 0, outFlow = 0;
-                for (int i : N) {
-                    if (i != j) {
-                        auto* varIn = X.asIndexed().try_get(i, j, k);
-                        auto* varOut = X.asIndexed().try_get(j, i, k);
-                        if (varIn) inFlow += *varIn;
-                        if (varOut) outFlow += *varOut;
-                    }
+                for (int i : arcs_.in(j)) {
+                    auto* varIn = X.asIndexed().try_get(i, j, k);
+                    if (varIn) inFlow += *varIn;
+                }
+                for (int i : arcs_.out(j)) {
+                    auto* varOut = X.asIndexed().try_get(j, i, k);
+                    if (varOut) outFlow += *varOut;
                 }
                 return inFlow == outFlow;
             }
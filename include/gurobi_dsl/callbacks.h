@@ -561,7 +561,8 @@ inline double CallbackSolution::operator()(const IndexedVariableSet& vs, int i,
 
 inline std::vector<double> CallbackSolution::getValues(const VariableGroup& vg) const {
     std::vector<double> result;
-    const_cast<VariableGroup&>(vg).forEach([&](GRBVar& v, const std::vector<int>&) {
+    result.reserve(vg.count());
+    vg.forEachVar([&](const GRBVar& v) {
         result.push_back(callback_->getSolutionValue(v));
     });
     return result;
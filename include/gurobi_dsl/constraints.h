@@ -16,6 +16,7 @@ KEY COMPONENTS
 - IndexedConstraintSet   - Constraints indexed by arbitrary domains (sparse)
 - ConstraintContainer    - Unified wrapper for dense/sparse (mirrors VariableContainer)
 - ConstraintFactory      - Unified backend for constraint creation
+- LinRow                 - Decomposed linear row for batched creation
 - ConstraintTable        - Enum-keyed registry of constraint collections
 
 DESIGN PHILOSOPHY
@@ -61,18 +62,35 @@ DEPENDENCIES
 ------------
 - <string>, <vector>, <array>, <tuple> - Container types
 - <stdexcept>, <format> - Error handling
-- <unordered_map>, <sstream> - Hash-based lookup
+- <sstream>, <span> - Index formatting, key views
 - <type_traits>, <concepts> - Compile-time type safety
+- <thread>, <mutex>, <condition_variable> - addIndexedParallel committer
 - "gurobi_c++.h" - Gurobi C++ API
 - "naming.h" - Debug-aware naming utilities
 - "enum_utils.h" - Enum reflection helpers
+- "tuple_index.h" - Integer-tuple hash index for IndexedConstraintSet
+- "thread_pool.h" - Worker pool for addIndexedParallel
+- "flat_traversal.h" - forEachConstr / forEachFlat shared by all containers
 
 PERFORMANCE NOTES
 -----------------
-- ConstraintGroup: O(1) random access via at()/operator()
-- IndexedConstraintSet: O(1) lookup via hash map on index tuples
+- ConstraintGroup: O(1) random access via at()/operator() on a contiguous
+  row-major buffer; forEach/slacks/duals scan it linearly
+- IndexedConstraintSet: O(1) lookup via integer-tuple hash (no allocation)
+  from variadic ints, std::array or std::span<const int>
+- forEachConstr / forEachFlat: plain loop over the contiguous constraint
+  array, no index tuple
+- IndexedConstraintSet memory: contiguous GRBConstr array + the TupleIndex's
+  packed index block (structure of arrays, no per-entry index vector)
 - Naming: O(1) when naming_disabled() (returns empty string)
 - ConstraintFactory: Linear in domain size for constraint creation
+- addIndexedBatched: generated row expressions are moved into a buffer and
+  committed via GRBModel::addConstrs in chunks of
+  ConstraintFactory::batchSize() rows (no per-term copies)
+- addIndexedParallel: generators run on a WorkStealingPool into per-chunk
+  row buffers while the calling thread commits finished chunks in order
+- getAttr()/setAttr(), slacks(), duals(): one array attribute call per
+  collection when its model is known (set by ConstraintFactory)
 
 THREAD SAFETY
 -------------
@@ -97,14 +115,27 @@ EXCEPTION SAFETY
 #include <type_traits>
 #include <concepts>
 #include <format>
-#include <unordered_map>
 #include <sstream>
 #include <tuple>
 #include <variant>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <climits>
+#include <span>
+#include <ranges>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #include "gurobi_c++.h"
 #include "naming.h"
 #include "enum_utils.h"
+#include "tuple_index.h"
+#include "flat_traversal.h"
+#include "thread_pool.h"
 
 namespace dsl {
 
@@ -123,17 +154,20 @@ namespace dsl {
      *  - 2D matrix of constraints  (dims == 2)
      *  - N-dimensional arrays      (dims == N)
      *
-     *  Internal representation uses a tree of Node objects where:
-     *  - Leaf nodes hold a single GRBConstr
-     *  - Container nodes have children.size() sub-nodes
+     *  Internal representation is one contiguous row-major GRBConstr buffer
+     *  with shape and stride arrays:
+     *  - Element (i0, ..., iN-1) lives at sum(ik * stride(k))
+     *  - A scalar group holds exactly one element and an empty shape
      *
      * @example
      *   ConstraintGroup cap = ConstraintFactory::add(model, "cap", gen, 10);
      *   GRBConstr& c = cap.at(3);  // access cap[3]
      *   cap.forEach([](GRBConstr& c, const auto& idx) { // iterate // });
      */
-    class ConstraintGroup {
+    class ConstraintGroup : public FlatTraversal<ConstraintGroup> {
     public:
+        // Tree description kept for source compatibility; ConstraintGroup(Node&&, int)
+        // flattens it into the contiguous layout.
         struct Node {
             GRBConstr scalar;
             std::vector<Node> children;
@@ -145,25 +179,66 @@ namespace dsl {
         };
 
     private:
-        Node root;
+        std::vector<GRBConstr> data;     // row-major element buffer
+        std::vector<size_t>    extents;  // size of each dimension
+        std::vector<size_t>    strides;  // row-major stride of each dimension
         int  dims = 0;
+        GRBModel* owner = nullptr;       // model holding the rows (if known)
 
     public:
         // ---------------------------------------------------------------------
         // Constructors
         // ---------------------------------------------------------------------
-        ConstraintGroup() = default;
+        ConstraintGroup() : data(1) {}
 
         explicit ConstraintGroup(const GRBConstr& c)
-            : root(Node(c)), dims(0) {
+            : data(1, c), dims(0) {
         }
 
         explicit ConstraintGroup(GRBConstr&& c)
-            : root(Node(std::move(c))), dims(0) {
+            : dims(0) {
+            data.push_back(std::move(c));
+        }
+
+        /// @brief Construct from a row-major buffer and its shape
+        /// @throws std::invalid_argument if constrs.size() != product of shp
+        ConstraintGroup(std::vector<GRBConstr>&& constrs, std::vector<size_t> shp)
+            : data(std::move(constrs)),
+              extents(std::move(shp)),
+              dims(static_cast<int>(extents.size())) {
+            computeStrides();
+            const size_t expected = dims == 0 ? 1 : total();
+            if (data.size() != expected) {
+                throw std::invalid_argument(
+                    std::format("ConstraintGroup: {} constraints do not match shape of {} elements",
+                        data.size(), expected));
+            }
         }
 
+        /// @brief Construct from a node tree (flattened into row-major storage)
+        /// @throws std::invalid_argument if d < 0 or the tree is not rectangular
         ConstraintGroup(Node&& r, int d)
-            : root(std::move(r)), dims(d) {
+            : dims(d) {
+            if (d < 0) {
+                throw std::invalid_argument(
+                    std::format("ConstraintGroup: negative dimension {}", d));
+            }
+            const Node* n = &r;
+            for (int k = 0; k < d; ++k) {
+                extents.push_back(n->children.size());
+                if (!n->children.empty()) {
+                    n = &n->children[0];
+                }
+            }
+            computeStrides();
+
+            if (d == 0) {
+                data.push_back(std::move(r.scalar));
+            }
+            else {
+                data.reserve(total());
+                flattenRec(r, 0);
+            }
         }
 
         // ---------------------------------------------------------------------
@@ -185,16 +260,7 @@ namespace dsl {
         /// @brief Returns the shape as a vector of dimension sizes
         /// @complexity O(dims)
         [[nodiscard]] std::vector<size_t> shape() const {
-            std::vector<size_t> shp;
-            shp.reserve(dims);
-            const Node* n = &root;
-
-            for (int d = 0; d < dims; ++d) {
-                if (n->children.empty()) break;
-                shp.push_back(n->children.size());
-                n = &n->children[0];
-            }
-            return shp;
+            return extents;
         }
 
         /// @brief Returns the size of a specific dimension
@@ -206,13 +272,39 @@ namespace dsl {
                     std::format("ConstraintGroup::size: dimension {} out of range [0, {})",
                         dim, dims));
             }
-            const Node* n = &root;
-            for (int d = 0; d < dim; ++d) {
-                n = &n->children[0];
+            return extents[static_cast<size_t>(dim)];
+        }
+
+        /// @brief Returns the total number of constraints (1 for scalars)
+        /// @noexcept
+        [[nodiscard]] size_t count() const noexcept { return data.size(); }
+
+        /// @brief Contiguous row-major view of all constraints (forEach order)
+        /// @noexcept
+        [[nodiscard]] std::span<GRBConstr> flat() noexcept { return data; }
+
+        /// @brief Const version of flat()
+        /// @noexcept
+        [[nodiscard]] std::span<const GRBConstr> flat() const noexcept { return data; }
+
+        /// @brief Returns the row-major stride of a dimension
+        /// @throws std::out_of_range if dim is out of range
+        [[nodiscard]] size_t stride(int dim) const {
+            if (dim < 0 || dim >= dims) {
+                throw std::out_of_range(
+                    std::format("ConstraintGroup::stride: dimension {} out of range [0, {})",
+                        dim, dims));
             }
-            return n->children.size();
+            return strides[static_cast<size_t>(dim)];
         }
 
+        /// @brief Model the constraints belong to (nullptr if built by hand)
+        /// @note Set by ConstraintFactory; enables array getAttr()/setAttr()
+        [[nodiscard]] GRBModel* model() const noexcept { return owner; }
+
+        /// @brief Record the model holding the constraints (enables bulk access)
+        void setModel(GRBModel& m) noexcept { owner = &m; }
+
         // ---------------------------------------------------------------------
         // Access
         // ---------------------------------------------------------------------
@@ -227,7 +319,11 @@ namespace dsl {
                     std::format("ConstraintGroup::at: expected {} indices, got {}",
                         dims, num));
             }
-            return atRec(root, idx...);
+
+            size_t offset = 0;
+            size_t d = 0;
+            ((offset += checkedIndex(static_cast<long long>(idx), d) * strides[d], ++d), ...);
+            return data[offset];
         }
 
         template<typename... Indices>
@@ -247,7 +343,7 @@ namespace dsl {
                 throw std::runtime_error(
                     std::format("ConstraintGroup::scalar: group is {}-dimensional", dims));
             }
-            return root.scalar;
+            return data.front();
         }
 
         const GRBConstr& scalar() const {
@@ -255,7 +351,7 @@ namespace dsl {
                 throw std::runtime_error(
                     std::format("ConstraintGroup::scalar: group is {}-dimensional", dims));
             }
-            return root.scalar;
+            return data.front();
         }
 
         GRBConstr& raw() { return scalar(); }
@@ -289,72 +385,71 @@ namespace dsl {
         // ---------------------------------------------------------------------
         template<typename Fn>
         void forEach(Fn&& fn) {
-            std::vector<int> idx;
-            idx.reserve(dims);
-            forEachRec(root, idx, fn);
+            forEachImpl(*this, fn);
         }
 
         /// @brief Const version of forEach()
         template<typename Fn>
         void forEach(Fn&& fn) const {
-            std::vector<int> idx;
-            idx.reserve(dims);
-            forEachRecConst(root, idx, fn);
+            forEachImpl(*this, fn);
         }
 
     private:
-        // leaf
-        GRBConstr& atRec(Node& n) {
-            return n.scalar;
+        size_t total() const noexcept {
+            size_t n = 1;
+            for (size_t e : extents) {
+                n *= e;
+            }
+            return n;
         }
 
-        // recursive
-        template<typename First, typename... Rest>
-        GRBConstr& atRec(Node& n, First i, Rest... rest) {
+        void computeStrides() {
+            strides.assign(extents.size(), 1);
+            for (size_t d = extents.size(); d-- > 1; ) {
+                strides[d - 1] = strides[d] * extents[d];
+            }
+        }
+
+        size_t checkedIndex(long long i, size_t d) const {
             if (i < 0) {
                 throw std::out_of_range(
-                    std::format("ConstraintGroup::atRec: negative index {}", i));
+                    std::format("ConstraintGroup::at: negative index {}", i));
             }
-            size_t idx = static_cast<size_t>(i);
-            if (idx >= n.children.size()) {
+            if (static_cast<unsigned long long>(i) >= extents[d]) {
                 throw std::out_of_range(
-                    std::format("ConstraintGroup::atRec: index {} out of range [0, {})",
-                        i, n.children.size()));
+                    std::format("ConstraintGroup::at: index {} out of range [0, {})",
+                        i, extents[d]));
             }
-            return atRec(n.children[idx], rest...);
+            return static_cast<size_t>(i);
         }
 
-        template<typename Fn>
-        static void forEachRec(Node& n,
-            std::vector<int>& idx,
-            Fn& fn) {
-            if (n.children.empty()) {
-                fn(n.scalar, idx);
-                return;
+        // appends the leaves of a node tree in row-major order
+        void flattenRec(Node& n, size_t d) {
+            if (n.children.size() != extents[d]) {
+                throw std::invalid_argument(
+                    std::format("ConstraintGroup: ragged node tree at dimension {} ({} vs {})",
+                        d, n.children.size(), extents[d]));
             }
-
-            for (size_t i = 0; i < n.children.size(); ++i) {
-                idx.push_back(static_cast<int>(i));
-                forEachRec(n.children[i], idx, fn);
-                idx.pop_back();
+            for (auto& child : n.children) {
+                if (d + 1 == extents.size()) {
+                    data.push_back(std::move(child.scalar));
+                }
+                else {
+                    flattenRec(child, d + 1);
+                }
             }
         }
 
-        /// @brief Recursive forEach implementation (const)
-        template<typename Fn>
-        static void forEachRecConst(const Node& n,
-            std::vector<int>& idx,
-            Fn& fn)
-        {
-            if (n.children.empty()) {
-                fn(n.scalar, idx);
-                return;
-            }
-
-            for (size_t i = 0; i < n.children.size(); ++i) {
-                idx.push_back(static_cast<int>(i));
-                forEachRecConst(n.children[i], idx, fn);
-                idx.pop_back();
+        // linear scan with an odometer-style index (mutable or const)
+        template<typename Self, typename Fn>
+        static void forEachImpl(Self& self, Fn& fn) {
+            std::vector<int> idx(static_cast<size_t>(self.dims), 0);
+            for (size_t k = 0; k < self.data.size(); ++k) {
+                fn(self.data[k], idx);
+                for (size_t d = idx.size(); d-- > 0; ) {
+                    if (static_cast<size_t>(++idx[d]) < self.extents[d]) break;
+                    idx[d] = 0;
+                }
             }
         }
 
@@ -374,27 +469,40 @@ namespace dsl {
      *  - I * J | filter(...) (filtered domains)
      *  - Irregular or sparse domains
      *
-     *  Not restricted to rectangular shapes. Each stored constraint has an
-     *  explicit index vector. Provides O(1) lookup via hash map.
+     *  Not restricted to rectangular shapes. Constraints are stored in one
+     *  contiguous array and their index tuples packed in the key block of an
+     *  integer-tuple hash index (TupleIndex), which gives O(1) lookups that
+     *  never allocate. Iteration yields Entry views (GRBConstr&, span).
      *
      * @example
      *   auto flow = ConstraintFactory::addIndexed(model, "flow", I * J, gen);
      *   GRBConstr& f = flow.at(2, 5);     // throws if not found
      *   GRBConstr* p = flow.try_get(2, 5); // nullptr if not found
+     *   std::array<int, 2> key{ 2, 5 };
+     *   flow.at(key);                      // std::array / std::span<const int>
      *   flow.forEach([](GRBConstr& c, const auto& idx) { // iterate // });
      */
-    class IndexedConstraintSet {
+    class IndexedConstraintSet : public FlatTraversal<IndexedConstraintSet> {
     public:
+        /// @brief View of one constraint and its index tuple (valid until the set is modified)
         struct Entry {
-            GRBConstr constr;
-            std::vector<int> index;
+            GRBConstr& constr;
+            std::span<const int> index;
+        };
+
+        /// @brief Read-only Entry view (const iteration)
+        struct ConstEntry {
+            const GRBConstr& constr;
+            std::span<const int> index;
         };
 
     private:
-        std::vector<Entry> entries;
-        std::unordered_map<std::string, std::size_t> indexMap;
+        std::vector<GRBConstr> constrs;   ///< Constraints in entry order, contiguous
+        TupleIndex lookup;                ///< Packed index tuples + hash index
+        GRBModel* owner = nullptr;
 
-        static std::string makeKeyFromVector(const std::vector<int>& idx) {
+        /// @brief Format an index tuple for error messages
+        static std::string makeKeyFromVector(std::span<const int> idx) {
             std::ostringstream oss;
             for (std::size_t k = 0; k < idx.size(); ++k) {
                 if (k > 0) {
@@ -405,10 +513,9 @@ namespace dsl {
             return oss.str();
         }
 
+        /// @brief Format variadic indices for error messages
         template<typename... I>
         static std::string makeKey(I... idx) {
-            static_assert((std::is_integral_v<I> && ...),
-                "IndexedConstraintSet::makeKey: indices must be integral");
             std::ostringstream oss;
             bool first = true;
             ((oss << (first ? (first = false, "") : "_")
@@ -416,11 +523,20 @@ namespace dsl {
             return oss.str();
         }
 
-        void addEntry(GRBConstr&& c, std::vector<int>&& idx) {
-            std::size_t pos = entries.size();
-            std::string key = makeKeyFromVector(idx);
-            indexMap.emplace(std::move(key), pos);
-            entries.push_back(Entry{ std::move(c), std::move(idx) });
+        void addEntry(GRBConstr c, std::span<const int> idx) {
+            lookup.insert(idx);
+            constrs.push_back(c);
+        }
+
+        /// @brief Call fn(constr, idx) per entry; idx is one reused scratch vector
+        template<typename Self, typename Fn>
+        static void forEachImpl(Self& self, Fn& fn) {
+            std::vector<int> idx;
+            for (std::size_t k = 0; k < self.constrs.size(); ++k) {
+                const auto key = self.lookup.key(k);
+                idx.assign(key.begin(), key.end());
+                fn(self.constrs[k], idx);
+            }
         }
 
     public:
@@ -429,80 +545,126 @@ namespace dsl {
 
         /// @brief Returns the number of constraints in the set
         /// @noexcept
-        [[nodiscard]] std::size_t size() const noexcept { return entries.size(); }
+        [[nodiscard]] std::size_t size() const noexcept { return constrs.size(); }
 
         /// @brief Returns true if the set is empty
         /// @noexcept
-        [[nodiscard]] bool empty() const noexcept { return entries.empty(); }
+        [[nodiscard]] bool empty() const noexcept { return constrs.empty(); }
+
+        /// @brief Contiguous view of all constraints in storage order (flat()[k] is all()[k].constr)
+        /// @noexcept
+        [[nodiscard]] std::span<const GRBConstr> flat() const noexcept { return constrs; }
 
-        using iterator = std::vector<Entry>::iterator;
-        using const_iterator = std::vector<Entry>::const_iterator;
+        /// @brief Mutable version of flat()
+        [[nodiscard]] std::span<GRBConstr> flat() noexcept { return constrs; }
 
-        iterator begin() noexcept { return entries.begin(); }
-        iterator end() noexcept { return entries.end(); }
+        /// @brief Model the constraints belong to (nullptr if built by hand)
+        [[nodiscard]] GRBModel* model() const noexcept { return owner; }
 
-        const_iterator begin() const noexcept { return entries.begin(); }
-        const_iterator end() const noexcept { return entries.end(); }
+        /// @brief Record the model holding the constraints (enables bulk access)
+        void setModel(GRBModel& m) noexcept { owner = &m; }
 
-        /// @brief Returns read-only access to all entries
+        /// @note Iterators yield Entry / ConstEntry by value (bind with `const auto&`)
+        using iterator = KeyedIterator<Entry, GRBConstr>;
+        using const_iterator = KeyedIterator<ConstEntry, const GRBConstr>;
+
+        iterator begin() noexcept { return { constrs.data(), &lookup, 0 }; }
+        iterator end() noexcept { return { constrs.data(), &lookup, constrs.size() }; }
+
+        const_iterator begin() const noexcept { return { constrs.data(), &lookup, 0 }; }
+        const_iterator end() const noexcept { return { constrs.data(), &lookup, constrs.size() }; }
+
+        /// @brief Random-access read-only view of all entries (all()[k], all().size())
         /// @noexcept
-        [[nodiscard]] const std::vector<Entry>& all() const noexcept { return entries; }
+        [[nodiscard]] std::ranges::subrange<const_iterator> all() const noexcept { return { begin(), end() }; }
 
         template<typename... I>
+            requires (std::is_integral_v<I> && ...)
         GRBConstr& at(I... idx) {
-            std::string key = makeKey(idx...);
-            auto it = indexMap.find(key);
-            if (it == indexMap.end()) {
+            const std::size_t pos = lookup.find(idx...);
+            if (pos == TupleIndex::npos) {
                 throw std::out_of_range(
-                    std::format("IndexedConstraintSet::at: index [{}] not found", key));
+                    std::format("IndexedConstraintSet::at: index [{}] not found", makeKey(idx...)));
             }
-            return entries[it->second].constr;
+            return constrs[pos];
         }
 
         template<typename... I>
+            requires (std::is_integral_v<I> && ...)
         const GRBConstr& at(I... idx) const {
             return const_cast<IndexedConstraintSet*>(this)->at(idx...);
         }
 
-        template<typename... I>
-        GRBConstr& operator()(I... idx) { return at(idx...); }
+        /// @brief at() from a packed index tuple (e.g. a slice of a caller-owned buffer)
+        GRBConstr& at(std::span<const int> idx) {
+            const std::size_t pos = lookup.find(idx);
+            if (pos == TupleIndex::npos) {
+                throw std::out_of_range(
+                    std::format("IndexedConstraintSet::at: index [{}] not found", makeKeyFromVector(idx)));
+            }
+            return constrs[pos];
+        }
 
-        template<typename... I>
-        const GRBConstr& operator()(I... idx) const { return at(idx...); }
+        const GRBConstr& at(std::span<const int> idx) const {
+            return const_cast<IndexedConstraintSet*>(this)->at(idx);
+        }
+
+        template<std::size_t N>
+        GRBConstr& at(const std::array<int, N>& idx) { return at(std::span<const int>(idx)); }
+
+        template<std::size_t N>
+        const GRBConstr& at(const std::array<int, N>& idx) const { return at(std::span<const int>(idx)); }
+
+        template<typename... Args>
+        GRBConstr& operator()(const Args&... idx) { return at(idx...); }
+
+        template<typename... Args>
+        const GRBConstr& operator()(const Args&... idx) const { return at(idx...); }
 
         template<typename... I>
+            requires (std::is_integral_v<I> && ...)
         GRBConstr* try_get(I... idx) noexcept {
-            try {
-                std::string key = makeKey(idx...);
-                auto it = indexMap.find(key);
-                if (it == indexMap.end()) {
-                    return nullptr;
-                }
-                return &entries[it->second].constr;
-            }
-            catch (...) {
-                return nullptr;
-            }
+            const std::size_t pos = lookup.find(idx...);
+            return pos == TupleIndex::npos ? nullptr : &constrs[pos];
         }
 
         template<typename... I>
+            requires (std::is_integral_v<I> && ...)
         const GRBConstr* try_get(I... idx) const noexcept {
             return const_cast<IndexedConstraintSet*>(this)->try_get(idx...);
         }
 
+        /// @brief try_get() from a packed index tuple
+        GRBConstr* try_get(std::span<const int> idx) noexcept {
+            const std::size_t pos = lookup.find(idx);
+            return pos == TupleIndex::npos ? nullptr : &constrs[pos];
+        }
+
+        const GRBConstr* try_get(std::span<const int> idx) const noexcept {
+            return const_cast<IndexedConstraintSet*>(this)->try_get(idx);
+        }
+
+        template<std::size_t N>
+        GRBConstr* try_get(const std::array<int, N>& idx) noexcept {
+            return try_get(std::span<const int>(idx));
+        }
+
+        template<std::size_t N>
+        const GRBConstr* try_get(const std::array<int, N>& idx) const noexcept {
+            return try_get(std::span<const int>(idx));
+        }
+
+        /// @brief Call fn(GRBConstr&, const std::vector<int>&) per entry
+        /// @note The index vector is one scratch buffer reused for the whole call
         template<typename Fn>
         void forEach(Fn&& fn) {
-            for (auto& e : entries) {
-                fn(e.constr, e.index);
-            }
+            forEachImpl(*this, fn);
         }
 
         /// @brief Const version of forEach()
         template<typename Fn>
         void forEach(Fn&& fn) const {
-            for (const auto& e : entries) {
-                fn(e.constr, e.index);
-            }
+            forEachImpl(*this, fn);
         }
 
     private:
@@ -545,7 +707,7 @@ namespace dsl {
      * @see IndexedConstraintSet
      * @see ConstraintTable
      */
-    class ConstraintContainer {
+    class ConstraintContainer : public FlatTraversal<ConstraintContainer> {
     public:
         /// @brief Storage mode enumeration
         enum class Mode { Empty, Dense, Sparse };
@@ -815,6 +977,51 @@ namespace dsl {
                     throw std::runtime_error("ConstraintContainer::forEach: container is empty");
             }
         }
+
+        /**
+         * @brief Contiguous view of all constraints in forEach order
+         * @throws std::runtime_error if container is empty
+         */
+        [[nodiscard]] std::span<GRBConstr> flat() {
+            switch (mode()) {
+                case Mode::Dense:
+                    return std::get<ConstraintGroup>(storage_).flat();
+                case Mode::Sparse:
+                    return std::get<IndexedConstraintSet>(storage_).flat();
+                default:
+                    throw std::runtime_error("ConstraintContainer::flat: container is empty");
+            }
+        }
+
+        /// @brief Const version of flat()
+        [[nodiscard]] std::span<const GRBConstr> flat() const {
+            return const_cast<ConstraintContainer*>(this)->flat();
+        }
+    };
+
+
+    // ============================================================================
+    // LINEAR ROW
+    // ============================================================================
+    /**
+     * @struct LinRow
+     * @brief Decomposed linear constraint `lhs (sense) rhs`
+     * @details
+     *  GRBTempConstr is opaque, so batched creation
+     *  (ConstraintFactory::addIndexedBatched) asks the generator for the row
+     *  parts instead. A constant term in `lhs` is moved to the right-hand side
+     *  when the row is buffered.
+     *
+     * @example
+     *   auto flow = ConstraintFactory::addIndexedBatched(model, "flow", I * J,
+     *       [&](int i, int j) {
+     *           return dsl::LinRow{ x(i, j) + y(i, j), GRB_LESS_EQUAL, demand[i][j] };
+     *       });
+     */
+    struct LinRow {
+        GRBLinExpr lhs;                 ///< Linear left-hand side
+        char       sense = GRB_LESS_EQUAL; ///< GRB_LESS_EQUAL, GRB_GREATER_EQUAL or GRB_EQUAL
+        double     rhs = 0.0;           ///< Right-hand side constant
     };
 
 
@@ -838,31 +1045,29 @@ namespace dsl {
         template<typename T>
         inline constexpr bool is_tuple_like_v = is_tuple_like<T>::value;
 
-        // converts scalar or tuple index into vector<int>
+        // converts scalar or tuple index into std::array<int, N> (no allocation)
         template<typename Idx>
-        std::vector<int> index_to_vector(const Idx& idx) {
+        auto index_to_array(const Idx& idx) {
             using Raw = std::remove_cvref_t<Idx>;
             if constexpr (is_tuple_like_v<Raw>) {
-                std::vector<int> v;
-                v.reserve(static_cast<std::size_t>(std::tuple_size_v<Raw>));
-                std::apply(
-                    [&](auto&&... args) {
-                        (v.push_back(static_cast<int>(args)), ...);
+                return std::apply(
+                    [](auto&&... args) {
+                        return std::array<int, sizeof...(args)>{ static_cast<int>(args)... };
                     },
                     idx
                 );
-                return v;
             }
             else {
                 static_assert(std::is_integral_v<Raw>,
-                    "index_to_vector: index must be int or tuple of ints");
-                return std::vector<int>{ static_cast<int>(idx) };
+                    "index_to_array: index must be int or tuple of ints");
+                return std::array<int, 1>{ static_cast<int>(idx) };
             }
         }
 
         // calls generator with either scalar or expanded tuple
+        // (returns whatever the generator returns: GRBTempConstr or LinRow)
         template<typename Generator, typename Idx>
-        GRBTempConstr invoke_on_index(Generator& gen, Idx&& idx) {
+        decltype(auto) invoke_on_index(Generator& gen, Idx&& idx) {
             using Raw = std::remove_cvref_t<Idx>;
             if constexpr (is_tuple_like_v<Raw>) {
                 return std::apply(
@@ -877,6 +1082,66 @@ namespace dsl {
             }
         }
 
+        /**
+         * @brief Row buffer for batched constraint creation
+         * @details
+         *  Holds the generated left-hand sides (moved in, not copied term by
+         *  term) with per-row sense, rhs and (when naming is enabled) name, in
+         *  the parallel arrays GRBModel::addConstrs takes. commit() hands the
+         *  buffered rows over in a single call and clears the buffer, keeping
+         *  its capacity for the next chunk.
+         */
+        class RowBuffer {
+        public:
+            /// @brief Number of buffered rows
+            [[nodiscard]] std::size_t rows() const noexcept { return senses.size(); }
+
+            /// @brief Append one row; its constant term is moved to the rhs
+            void append(LinRow&& row, std::string name) {
+                const double constant = row.lhs.getConstant();
+                if (constant != 0.0) {
+                    row.lhs -= GRBLinExpr(constant);
+                }
+                exprs.push_back(std::move(row.lhs));
+                senses.push_back(row.sense);
+                rhs.push_back(row.rhs - constant);
+                if constexpr (naming_enabled()) {
+                    names.push_back(std::move(name));
+                }
+            }
+
+            /// @brief Add all buffered rows to the model; appends the new
+            ///        constraints to `out` in row order and clears the buffer
+            void commit(GRBModel& model, std::vector<GRBConstr>& out) {
+                const std::size_t n = rows();
+                if (n == 0) {
+                    return;
+                }
+
+                std::unique_ptr<GRBConstr[]> block(model.addConstrs(
+                    exprs.data(), senses.data(), rhs.data(),
+                    naming_enabled() ? names.data() : nullptr,
+                    static_cast<int>(n)));
+                out.insert(out.end(), block.get(), block.get() + n);
+
+                clear();
+            }
+
+            /// @brief Drop buffered rows (capacity is kept)
+            void clear() noexcept {
+                exprs.clear();
+                senses.clear();
+                rhs.clear();
+                names.clear();
+            }
+
+        private:
+            std::vector<GRBLinExpr>  exprs;    ///< Per-row left-hand side (constant-free)
+            std::vector<char>        senses;   ///< Per-row sense
+            std::vector<double>      rhs;      ///< Per-row right-hand side
+            std::vector<std::string> names;    ///< Per-row names (naming builds only)
+        };
+
     } // namespace constraint_detail
 
 
@@ -890,6 +1155,10 @@ namespace dsl {
      *  Provides static methods for creating constraints:
      *  - add(): Creates rectangular ConstraintGroup (dense N-D arrays)
      *  - addIndexed(): Creates IndexedConstraintSet from arbitrary domains
+     *  - addIndexedBatched(): Same result as addIndexed(), built from LinRow
+     *    generators and inserted in bulk
+     *  - addIndexedParallel(): Same result as addIndexedBatched(), with the
+     *    generator evaluated on worker threads
      *
      *  **Generator Functions**
      *
@@ -970,22 +1239,38 @@ namespace dsl {
                 GRBTempConstr tmp = gen(std::vector<int>{});
                 std::string   nm = make_name::concat(baseName);
                 GRBConstr     c = addConstrOpt(model, tmp, nm);
-                return ConstraintGroup(std::move(c));
+                ConstraintGroup result(std::move(c));
+                result.owner = &model;
+                return result;
             }
             else {
-                // N-D
-                std::vector<int> indices;
+                // N-D: generate in row-major order straight into the flat buffer
                 Generator genLocal = std::forward<Generator>(gen);
+                std::vector<size_t> shp = checkedShape(sizes...);
+
+                size_t total = 1;
+                for (size_t e : shp) {
+                    total *= e;
+                }
 
-                Node root = addNodeImpl(
-                    model, baseName,
-                    genLocal,
-                    indices,
-                    sizes...);
+                std::vector<GRBConstr> constrs;
+                constrs.reserve(total);
+                std::vector<int> idx(shp.size(), 0);
 
-                return ConstraintGroup(
-                    std::move(root),
-                    static_cast<int>(sizeof...(sizes)));
+                for (size_t k = 0; k < total; ++k) {
+                    std::string   nm = make_name::math(baseName, idx);
+                    GRBTempConstr tmp = genLocal(idx);
+                    constrs.push_back(addConstrOpt(model, tmp, nm));
+
+                    for (size_t d = idx.size(); d-- > 0; ) {
+                        if (static_cast<size_t>(++idx[d]) < shp[d]) break;
+                        idx[d] = 0;
+                    }
+                }
+
+                ConstraintGroup result(std::move(constrs), std::move(shp));
+                result.owner = &model;
+                return result;
             }
         }
 
@@ -1013,65 +1298,259 @@ namespace dsl {
             Generator&& gen)
         {
             IndexedConstraintSet result;
+            result.owner = &model;
             Generator genLocal = std::forward<Generator>(gen);
 
             for (auto&& rawIdx : domain) {
-                auto idxVec = constraint_detail::index_to_vector(rawIdx);
+                const auto idx = constraint_detail::index_to_array(rawIdx);
 
                 GRBTempConstr tmp =
                     constraint_detail::invoke_on_index(genLocal, rawIdx);
 
                 std::string name =
-                    make_name::math(baseName, idxVec);
+                    make_name::math(baseName, idx);
 
                 GRBConstr c = addConstrOpt(model, tmp, name);
-                result.addEntry(std::move(c), std::move(idxVec));
+                result.addEntry(c, idx);
             }
 
             return result;
         }
 
-    private:
-        // ---------------------------------------------------------------------
-        // Rectangular tree construction
-        // ---------------------------------------------------------------------
-        template<typename Generator, typename SizeType, typename... Sizes>
-        static Node addNodeImpl(
+        /**
+         * @brief Create an IndexedConstraintSet through batched row insertion
+         * @tparam Domain Iterable domain (e.g., IndexList, RangeView, Cartesian, Filtered)
+         * @tparam Generator Callable with signature `LinRow(int, int, ...)` matching domain arity
+         * @param model The Gurobi model to add constraints to
+         * @param baseName Base name for constraint naming
+         * @param domain Index domain to iterate over
+         * @param gen Generator function that produces a LinRow for each index tuple
+         * @return IndexedConstraintSet identical in content and order to addIndexed()
+         *
+         * @details Row expressions are moved into a buffer and committed through
+         *          GRBModel::addConstrs every batchSize() rows, instead of one
+         *          addConstr call per row.
+         *
+         * @example
+         *   auto flow = ConstraintFactory::addIndexedBatched(model, "flow", I * J,
+         *       [&](int i, int j) {
+         *           return dsl::LinRow{ x(i, j) + y(i, j), GRB_LESS_EQUAL, demand[i][j] };
+         *       });
+         */
+        template<typename Domain, typename Generator>
+        static IndexedConstraintSet addIndexedBatched(
             GRBModel& model,
             const std::string& baseName,
-            Generator& gen,
-            std::vector<int>& idx,
-            SizeType n,
-            Sizes... sizes)
+            const Domain& domain,
+            Generator&& gen)
         {
-            static_assert(std::is_integral_v<SizeType>,
-                "ConstraintFactory::addNodeImpl: size must be integral");
+            Generator genLocal = std::forward<Generator>(gen);
+            const std::size_t chunk = batchSize();
 
-            if (n < 0) {
-                throw std::invalid_argument(
-                    std::format("ConstraintFactory::addNodeImpl: negative size {}", n));
+            constraint_detail::RowBuffer buffer;
+            IndexedConstraintSet result;
+            result.owner = &model;
+
+            for (auto&& rawIdx : domain) {
+                using Row = decltype(constraint_detail::invoke_on_index(genLocal, rawIdx));
+                static_assert(std::is_convertible_v<Row, LinRow>,
+                    "ConstraintFactory::addIndexedBatched: generator must return dsl::LinRow");
+
+                const auto idx = constraint_detail::index_to_array(rawIdx);
+                LinRow row = constraint_detail::invoke_on_index(genLocal, rawIdx);
+
+                buffer.append(std::move(row), naming_enabled()
+                    ? make_name::math(baseName, idx)
+                    : std::string{});
+                result.lookup.insert(idx);
+
+                if (buffer.rows() == chunk) {
+                    buffer.commit(model, result.constrs);
+                }
             }
+            buffer.commit(model, result.constrs);
 
-            Node node(static_cast<size_t>(n));
+            return result;
+        }
 
-            for (SizeType i = 0; i < n; ++i) {
-                idx.push_back(static_cast<int>(i));
+        /**
+         * @brief Create an IndexedConstraintSet with rows generated on worker threads
+         * @tparam Domain Iterable domain (e.g., IndexList, RangeView, Cartesian, Filtered)
+         * @tparam Generator Callable with signature `LinRow(int, int, ...)` matching domain arity
+         * @param model The Gurobi model to add constraints to
+         * @param baseName Base name for constraint naming
+         * @param domain Index domain to iterate over
+         * @param gen Generator; called concurrently from several threads
+         * @param pool Pool evaluating the generator (default: WorkStealingPool::global())
+         * @return IndexedConstraintSet identical in content and order to addIndexedBatched()
+         *
+         * @details The domain is cut by rank into contiguous chunks of at most
+         *          batchSize() rows. Pool workers fill one RowBuffer per chunk
+         *          while the calling thread, as the single committer, waits
+         *          for chunk 0, 1, 2, ... in turn and hands each to
+         *          GRBModel::addConstrs. Rows therefore reach the model in
+         *          domain order, and generation overlaps with insertion.
+         *
+         * @throws The first exception thrown by gen; rows of chunks committed
+         *         before the failure remain in the model (as with the serial path)
+         *
+         * @note Called from inside a task of the same pool, rows are generated
+         *       on the calling thread instead (no nested parallelism).
+         *
+         * @example
+         *   auto flow = ConstraintFactory::addIndexedParallel(model, "flow", I * J,
+         *       [&](int i, int j) {
+         *           return dsl::LinRow{ x(i, j) + y(i, j), GRB_LESS_EQUAL, capacity(i, j) };
+         *       });
+         */
+        template<typename Domain, typename Generator>
+        static IndexedConstraintSet addIndexedParallel(
+            GRBModel& model,
+            const std::string& baseName,
+            const Domain& domain,
+            Generator&& gen,
+            WorkStealingPool& pool = WorkStealingPool::global())
+        {
+            if (WorkStealingPool::insideTask()) {
+                return addIndexedBatched(model, baseName, domain, std::forward<Generator>(gen));
+            }
 
-                if constexpr (sizeof...(Sizes) == 0) {
-                    std::string   nm = make_name::math(baseName, idx);
-                    GRBTempConstr tmp = gen(idx);
-                    node.children[static_cast<size_t>(i)] =
-                        Node(addConstrOpt(model, tmp, nm));
+            Generator genLocal = std::forward<Generator>(gen);
+            const pool_detail::RankSlicer<Domain> slicer(domain);
+            const std::size_t n = slicer.size();
+            const std::size_t perBatch = batchSize();
+            const std::size_t chunks = std::max(pool_detail::chunkCount(n, pool),
+                (n + perBatch - 1) / perBatch);
+
+            struct Chunk {
+                constraint_detail::RowBuffer rows;
+                std::vector<int>             keys;       ///< Packed index tuples
+                std::size_t                  arity = 0;
+                bool                         ready = false;
+            };
+            std::vector<Chunk> work(chunks);
+            std::mutex mutex;
+            std::condition_variable readyCv;
+            bool producerDone = false;
+            std::exception_ptr producerError;
+            std::atomic<bool> abort{ false };
+
+            // Producer: evaluates generator chunks on the pool
+            std::thread producer([&] {
+                try {
+                    pool.run(chunks, [&](std::size_t c) {
+                        if (abort.load(std::memory_order_relaxed)) {
+                            return;
+                        }
+                        Chunk& ck = work[c];
+                        slicer.visit(n * c / chunks, n * (c + 1) / chunks, [&](const auto& rawIdx) {
+                            using Row = decltype(constraint_detail::invoke_on_index(genLocal, rawIdx));
+                            static_assert(std::is_convertible_v<Row, LinRow>,
+                                "ConstraintFactory::addIndexedParallel: generator must return dsl::LinRow");
+
+                            const auto idx = constraint_detail::index_to_array(rawIdx);
+                            LinRow row = constraint_detail::invoke_on_index(genLocal, rawIdx);
+                            ck.rows.append(std::move(row), naming_enabled()
+                                ? make_name::math(baseName, idx)
+                                : std::string{});
+                            ck.keys.insert(ck.keys.end(), idx.begin(), idx.end());
+                            ck.arity = idx.size();
+                        });
+                        {
+                            std::lock_guard lock(mutex);
+                            ck.ready = true;
+                        }
+                        readyCv.notify_all();
+                    });
                 }
-                else {
-                    node.children[static_cast<size_t>(i)] =
-                        addNodeImpl(model, baseName, gen, idx, sizes...);
+                catch (...) {
+                    producerError = std::current_exception();
                 }
+                {
+                    std::lock_guard lock(mutex);
+                    producerDone = true;
+                }
+                readyCv.notify_all();
+            });
 
-                idx.pop_back();
+            // Committer (this thread): add chunks to the model in rank order
+            IndexedConstraintSet result;
+            result.owner = &model;
+            result.constrs.reserve(n);
+            result.lookup.reserve(n);
+            try {
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    {
+                        std::unique_lock lock(mutex);
+                        readyCv.wait(lock, [&] { return work[c].ready || producerDone; });
+                        if (!work[c].ready) {
+                            break;   // producer failed before finishing chunk c
+                        }
+                    }
+                    Chunk& ck = work[c];
+                    ck.rows.commit(model, result.constrs);
+                    const std::span<const int> keys(ck.keys);
+                    for (std::size_t off = 0; off < keys.size(); off += ck.arity) {
+                        result.lookup.insert(keys.subspan(off, ck.arity));
+                    }
+                    ck = Chunk{};   // release the chunk's buffers early
+                }
+            }
+            catch (...) {
+                abort = true;
+                producer.join();
+                throw;
+            }
+            producer.join();
+            if (producerError) {
+                std::rethrow_exception(producerError);
             }
 
-            return node;
+            return result;
+        }
+
+        // ---------------------------------------------------------------------
+        // Batch configuration
+        // ---------------------------------------------------------------------
+
+        /// @brief Default number of rows per GRBModel::addConstrs call
+        static constexpr std::size_t DEFAULT_BATCH_SIZE = 65536;
+
+        /**
+         * @brief Set the number of rows committed per GRBModel::addConstrs call
+         * @param n Chunk size used by addIndexedBatched() and addIndexedParallel()
+         * @throws std::invalid_argument if n == 0 or n > INT_MAX
+         * @note The setting is process-wide (mirrors VariableFactory::setBatchSize).
+         */
+        static void setBatchSize(std::size_t n) {
+            if (n == 0 || n > static_cast<std::size_t>(INT_MAX)) {
+                throw std::invalid_argument(
+                    std::format("ConstraintFactory::setBatchSize: invalid size {}", n));
+            }
+            batchSizeValue.store(n, std::memory_order_relaxed);
+        }
+
+        /// @brief Returns the current addConstrs chunk size
+        /// @noexcept
+        [[nodiscard]] static std::size_t batchSize() noexcept {
+            return batchSizeValue.load(std::memory_order_relaxed);
+        }
+
+    private:
+        inline static std::atomic<std::size_t> batchSizeValue{ DEFAULT_BATCH_SIZE };
+
+        // ---------------------------------------------------------------------
+        // Shape validation for rectangular groups
+        // ---------------------------------------------------------------------
+        template<typename... Sizes>
+        static std::vector<size_t> checkedShape(Sizes... sizes) {
+            std::vector<size_t> shp;
+            shp.reserve(sizeof...(Sizes));
+            ((sizes < 0
+                ? throw std::invalid_argument(
+                    std::format("ConstraintFactory::add: negative size {}", sizes))
+                : shp.push_back(static_cast<size_t>(sizes))), ...);
+            return shp;
         }
 
         // ---------------------------------------------------------------------
@@ -1478,6 +1957,231 @@ namespace dsl {
     /** @} */ // end of ConstraintAttributes group
 
 
+    // ============================================================================
+    // BULK CONSTRAINT ATTRIBUTES
+    // ============================================================================
+    /**
+     * @defgroup ConstraintBulkAttributes Bulk Constraint Attribute Access
+     * @brief Read or write one double attribute for a whole constraint collection
+     *
+     * @details getAttr()/setAttr() move the values of RHS, Slack, Pi, ... for every
+     *          row of a collection through one array attribute call
+     *          (GRBModel::get/set(attr, constrs, ...)). Values are aligned with the
+     *          collection's iteration order: row-major for ConstraintGroup,
+     *          storage order for IndexedConstraintSet.
+     *
+     *          Every collection (ConstraintGroup, IndexedConstraintSet,
+     *          ConstraintContainer) has the same overload set as the variable
+     *          containers: getAttr(c, attr) -> vector, getAttr(c, attr, out)
+     *          into a std::span<double>, setAttr(c, attr, vals), each also
+     *          taking the model first: getAttr(model, c, ...) / setAttr(model, c, ...).
+     *
+     *          The array calls need the owning model, which ConstraintFactory
+     *          records (see ConstraintGroup::model()). For collections built by
+     *          hand, pass the model explicitly or call setModel(); without
+     *          either, the model-less overloads read and write one row at a time.
+     *
+     * @example
+     *   std::vector<double> rhs = dsl::getAttr(cap, GRB_DoubleAttr_RHS);
+     *   for (double& r : rhs) r *= 1.1;
+     *   dsl::setAttr(cap, GRB_DoubleAttr_RHS, rhs);          // one array call
+     *   dsl::setAttr(tbl(Cons::Cap), GRB_DoubleAttr_RHS, rhs); // via ConstraintTable
+     *   auto pi = dsl::getAttr(model, handBuilt, GRB_DoubleAttr_Pi);
+     *
+     * @{
+     */
+
+    namespace constraint_detail {
+
+        /// @brief Largest run passed to a single Gurobi array call
+        inline int chunkAt(std::size_t remaining) noexcept {
+            return static_cast<int>(std::min<std::size_t>(remaining, static_cast<std::size_t>(INT_MAX)));
+        }
+
+        inline void checkAligned(std::size_t rows, std::size_t values, const char* what) {
+            if (rows != values) {
+                throw std::invalid_argument(
+                    std::format("{}: {} values for {} constraints", what, values, rows));
+            }
+        }
+
+        /// @brief Read attr for a contiguous run of constraints into out
+        inline void bulkGet(GRBModel* model, std::span<const GRBConstr> constrs,
+            GRB_DoubleAttr attr, std::span<double> out)
+        {
+            checkAligned(constrs.size(), out.size(), "getAttr");
+            if (model == nullptr) {
+                for (std::size_t k = 0; k < constrs.size(); ++k) {
+                    out[k] = constrs[k].get(attr);
+                }
+                return;
+            }
+            for (std::size_t done = 0; done < constrs.size(); ) {
+                const int n = chunkAt(constrs.size() - done);
+                std::unique_ptr<double[]> buf(model->get(attr, constrs.data() + done, n));
+                std::copy_n(buf.get(), n, out.begin() + static_cast<std::ptrdiff_t>(done));
+                done += static_cast<std::size_t>(n);
+            }
+        }
+
+        /// @brief Write attr for a contiguous run of constraints from vals
+        inline void bulkSet(GRBModel* model, std::span<const GRBConstr> constrs,
+            GRB_DoubleAttr attr, std::span<const double> vals)
+        {
+            checkAligned(constrs.size(), vals.size(), "setAttr");
+            if (model == nullptr) {
+                for (std::size_t k = 0; k < constrs.size(); ++k) {
+                    GRBConstr c = constrs[k];
+                    c.set(attr, vals[k]);
+                }
+                return;
+            }
+            for (std::size_t done = 0; done < constrs.size(); ) {
+                const int n = chunkAt(constrs.size() - done);
+                model->set(attr, constrs.data() + done, vals.data() + done, n);
+                done += static_cast<std::size_t>(n);
+            }
+        }
+
+        /// @brief Constraints of a non-empty container
+        /// @throws std::runtime_error if the container is empty
+        inline std::span<const GRBConstr> constrsOf(const ConstraintContainer& cc, const char* what) {
+            if (cc.isEmpty()) {
+                throw std::runtime_error(std::format("ConstraintContainer::{}: container is empty", what));
+            }
+            return cc.flat();
+        }
+
+        /// @brief Model recorded by a non-empty container (nullptr if built by hand)
+        inline GRBModel* modelOf(const ConstraintContainer& cc) {
+            return cc.isDense() ? cc.asGroup().model() : cc.asIndexed().model();
+        }
+
+    } // namespace constraint_detail
+
+    /**
+     * @brief Read a double attribute for every row of a ConstraintGroup into out
+     * @param out Destination, out.size() must equal cg.count()
+     * @throws std::invalid_argument on size mismatch
+     * @throws GRBException if the attribute is not available
+     */
+    inline void getAttr(const ConstraintGroup& cg, GRB_DoubleAttr attr, std::span<double> out) {
+        constraint_detail::bulkGet(cg.model(), cg.flat(), attr, out);
+    }
+
+    /// @brief Read a double attribute for every row of a ConstraintGroup
+    inline std::vector<double> getAttr(const ConstraintGroup& cg, GRB_DoubleAttr attr) {
+        std::vector<double> out(cg.count());
+        getAttr(cg, attr, out);
+        return out;
+    }
+
+    /// @brief getAttr() with an explicit model into a caller buffer
+    inline void getAttr(GRBModel& model, const ConstraintGroup& cg, GRB_DoubleAttr attr, std::span<double> out) {
+        constraint_detail::bulkGet(&model, cg.flat(), attr, out);
+    }
+
+    /// @brief getAttr() with an explicit model (for groups built without ConstraintFactory)
+    inline std::vector<double> getAttr(GRBModel& model, const ConstraintGroup& cg, GRB_DoubleAttr attr) {
+        std::vector<double> out(cg.count());
+        getAttr(model, cg, attr, out);
+        return out;
+    }
+
+    /**
+     * @brief Write a double attribute for every row of a ConstraintGroup
+     * @param vals One value per row in row-major order
+     * @throws std::invalid_argument if vals.size() != cg.count()
+     */
+    inline void setAttr(const ConstraintGroup& cg, GRB_DoubleAttr attr, std::span<const double> vals) {
+        constraint_detail::bulkSet(cg.model(), cg.flat(), attr, vals);
+    }
+
+    /// @brief setAttr() with an explicit model
+    inline void setAttr(GRBModel& model, const ConstraintGroup& cg, GRB_DoubleAttr attr, std::span<const double> vals) {
+        constraint_detail::bulkSet(&model, cg.flat(), attr, vals);
+    }
+
+    /// @brief Read a double attribute for every row of an IndexedConstraintSet into out
+    inline void getAttr(const IndexedConstraintSet& cs, GRB_DoubleAttr attr, std::span<double> out) {
+        constraint_detail::bulkGet(cs.model(), cs.flat(), attr, out);
+    }
+
+    /// @brief Read a double attribute for every row of an IndexedConstraintSet
+    inline std::vector<double> getAttr(const IndexedConstraintSet& cs, GRB_DoubleAttr attr) {
+        std::vector<double> out(cs.size());
+        getAttr(cs, attr, out);
+        return out;
+    }
+
+    /// @brief getAttr() with an explicit model into a caller buffer
+    inline void getAttr(GRBModel& model, const IndexedConstraintSet& cs, GRB_DoubleAttr attr, std::span<double> out) {
+        constraint_detail::bulkGet(&model, cs.flat(), attr, out);
+    }
+
+    /// @brief getAttr() with an explicit model
+    inline std::vector<double> getAttr(GRBModel& model, const IndexedConstraintSet& cs, GRB_DoubleAttr attr) {
+        std::vector<double> out(cs.size());
+        getAttr(model, cs, attr, out);
+        return out;
+    }
+
+    /// @brief Write a double attribute for every row of an IndexedConstraintSet (storage order)
+    inline void setAttr(const IndexedConstraintSet& cs, GRB_DoubleAttr attr, std::span<const double> vals) {
+        constraint_detail::bulkSet(cs.model(), cs.flat(), attr, vals);
+    }
+
+    /// @brief setAttr() with an explicit model
+    inline void setAttr(GRBModel& model, const IndexedConstraintSet& cs, GRB_DoubleAttr attr, std::span<const double> vals) {
+        constraint_detail::bulkSet(&model, cs.flat(), attr, vals);
+    }
+
+    /**
+     * @brief Read a double attribute for every row of a ConstraintContainer into out
+     * @throws std::runtime_error if container is empty
+     */
+    inline void getAttr(const ConstraintContainer& cc, GRB_DoubleAttr attr, std::span<double> out) {
+        const auto constrs = constraint_detail::constrsOf(cc, "getAttr");
+        constraint_detail::bulkGet(constraint_detail::modelOf(cc), constrs, attr, out);
+    }
+
+    /// @brief Read a double attribute for every row of a ConstraintContainer
+    inline std::vector<double> getAttr(const ConstraintContainer& cc, GRB_DoubleAttr attr) {
+        std::vector<double> out(constraint_detail::constrsOf(cc, "getAttr").size());
+        getAttr(cc, attr, out);
+        return out;
+    }
+
+    /// @brief getAttr() with an explicit model into a caller buffer
+    inline void getAttr(GRBModel& model, const ConstraintContainer& cc, GRB_DoubleAttr attr, std::span<double> out) {
+        constraint_detail::bulkGet(&model, constraint_detail::constrsOf(cc, "getAttr"), attr, out);
+    }
+
+    /// @brief getAttr() with an explicit model
+    inline std::vector<double> getAttr(GRBModel& model, const ConstraintContainer& cc, GRB_DoubleAttr attr) {
+        std::vector<double> out(constraint_detail::constrsOf(cc, "getAttr").size());
+        getAttr(model, cc, attr, out);
+        return out;
+    }
+
+    /**
+     * @brief Write a double attribute for every row of a ConstraintContainer
+     * @throws std::runtime_error if container is empty
+     * @throws std::invalid_argument if vals.size() differs from the number of rows
+     */
+    inline void setAttr(const ConstraintContainer& cc, GRB_DoubleAttr attr, std::span<const double> vals) {
+        const auto constrs = constraint_detail::constrsOf(cc, "setAttr");
+        constraint_detail::bulkSet(constraint_detail::modelOf(cc), constrs, attr, vals);
+    }
+
+    /// @brief setAttr() with an explicit model
+    inline void setAttr(GRBModel& model, const ConstraintContainer& cc, GRB_DoubleAttr attr, std::span<const double> vals) {
+        constraint_detail::bulkSet(&model, constraint_detail::constrsOf(cc, "setAttr"), attr, vals);
+    }
+
+    /** @} */ // end of ConstraintBulkAttributes group
+
+
     // ============================================================================
     // CONSTRAINT SOLUTION EXTRACTION
     // ============================================================================
@@ -1486,7 +2190,8 @@ namespace dsl {
      * @brief Functions for retrieving post-optimization constraint values
      *
      * @details After optimization, these utilities extract slack and dual
-     *          values from constraint collections.
+     *          values from constraint collections. They are getAttr() with
+     *          GRB_DoubleAttr_Slack / GRB_DoubleAttr_Pi.
      *
      * @{
      */
@@ -1501,11 +2206,7 @@ namespace dsl {
      * @complexity O(n) where n = total number of constraints
      */
     inline std::vector<double> slacks(const ConstraintGroup& cg) {
-        std::vector<double> result;
-        const_cast<ConstraintGroup&>(cg).forEach([&](GRBConstr& c, const std::vector<int>&) {
-            result.push_back(c.get(GRB_DoubleAttr_Slack));
-        });
-        return result;
+        return getAttr(cg, GRB_DoubleAttr_Slack);
     }
 
     /**
@@ -1518,12 +2219,7 @@ namespace dsl {
      * @complexity O(n) where n = number of constraints
      */
     inline std::vector<double> slacks(const IndexedConstraintSet& cs) {
-        std::vector<double> result;
-        result.reserve(cs.size());
-        for (const auto& e : cs.all()) {
-            result.push_back(e.constr.get(GRB_DoubleAttr_Slack));
-        }
-        return result;
+        return getAttr(cs, GRB_DoubleAttr_Slack);
     }
 
     /**
@@ -1536,11 +2232,7 @@ namespace dsl {
      * @complexity O(n) where n = total number of constraints
      */
     inline std::vector<double> duals(const ConstraintGroup& cg) {
-        std::vector<double> result;
-        const_cast<ConstraintGroup&>(cg).forEach([&](GRBConstr& c, const std::vector<int>&) {
-            result.push_back(c.get(GRB_DoubleAttr_Pi));
-        });
-        return result;
+        return getAttr(cg, GRB_DoubleAttr_Pi);
     }
 
     /**
@@ -1553,12 +2245,7 @@ namespace dsl {
      * @complexity O(n) where n = number of constraints
      */
     inline std::vector<double> duals(const IndexedConstraintSet& cs) {
-        std::vector<double> result;
-        result.reserve(cs.size());
-        for (const auto& e : cs.all()) {
-            result.push_back(e.constr.get(GRB_DoubleAttr_Pi));
-        }
-        return result;
+        return getAttr(cs, GRB_DoubleAttr_Pi);
     }
 
     /**
@@ -1572,11 +2259,7 @@ namespace dsl {
      * @complexity O(n) where n = total number of constraints
      */
     inline std::vector<double> slacks(const ConstraintContainer& cc) {
-        std::vector<double> result;
-        cc.forEach([&](const GRBConstr& c, const std::vector<int>&) {
-            result.push_back(c.get(GRB_DoubleAttr_Slack));
-        });
-        return result;
+        return getAttr(cc, GRB_DoubleAttr_Slack);
     }
 
     /**
@@ -1590,11 +2273,7 @@ namespace dsl {
      * @complexity O(n) where n = total number of constraints
      */
     inline std::vector<double> duals(const ConstraintContainer& cc) {
-        std::vector<double> result;
-        cc.forEach([&](const GRBConstr& c, const std::vector<int>&) {
-            result.push_back(c.get(GRB_DoubleAttr_Pi));
-        });
-        return result;
+        return getAttr(cc, GRB_DoubleAttr_Pi);
     }
 
     /** @} */ // end of ConstraintSolution group
@@ -13,12 +13,16 @@ a clean, expressive syntax.
 WHAT'S INCLUDED
 ---------------
  indexing.h      Index domains, Cartesian products, filtering
+ tuple_index.h   Integer-tuple hash index for indexed sets
+ thread_pool.h   Work-stealing pool and rank partitioning of domains
+ flat_traversal.h  Index-free forEachVar/forEachConstr/forEachFlat mixin
  naming.h        Debug/release variable naming utilities
  enum_utils.h    Compile-time enum helpers (DECLARE_ENUM_WITH_COUNT)
  data_store.h    Type-erased key-value storage
  variables.h     Variable groups, indexed sets, VariableTable
  constraints.h   Constraint groups, indexed sets, ConstraintTable
  expressions.h   Expression building helpers (sum, etc.)
+ parallel.h      Deterministic parallel_for / parallel_sum over domains
  model_builder.h High-level model construction template
  callbacks.h     MIP callback framework
  diagnostics.h   Model analysis and debugging utilities
@@ -100,6 +104,15 @@ See LICENSE file in repository root.
 // Index domains (no dependencies)
 #include "indexing.h"
 
+// Integer-tuple hash index (no dependencies, used by variables)
+#include "tuple_index.h"
+
+// Work-stealing pool (no dependencies, used by constraints and parallel)
+#include "thread_pool.h"
+
+// Index-free container traversals (no dependencies, used by variables/constraints)
+#include "flat_traversal.h"
+
 // Variables (depends on naming, enum_utils, indexing concepts)
 #include "variables.h"
 
@@ -109,6 +122,9 @@ See LICENSE file in repository root.
 // Expressions (depends on variables, indexing)
 #include "expressions.h"
 
+// Parallel loops (depends on expressions, indexing)
+#include "parallel.h"
+
 // ============================================================================
 // HIGH-LEVEL COMPONENTS
 // ============================================================================
@@ -131,20 +147,25 @@ See LICENSE file in repository root.
  * @brief Main namespace for all DSL components
  *
  * Core types:
- * - dsl::IndexList, dsl::RangeView, dsl::Cartesian, dsl::Filtered
+ * - dsl::IndexList, dsl::RangeView, dsl::IntervalSet, dsl::Relation, dsl::Cartesian, dsl::Filtered, dsl::PushdownFiltered
+ * - dsl::TupleList, dsl::Cached, dsl::BatchFiltered, dsl::GroupIndex
  * - dsl::VariableGroup, dsl::IndexedVariableSet, dsl::VariableTable
+ * - dsl::VarArray<N>, dsl::SparseVars<N>
  * - dsl::ConstraintGroup, dsl::IndexedConstraintSet, dsl::ConstraintTable
  * - dsl::VariableFactory, dsl::ConstraintFactory
+ * - dsl::LinExprBuilder, dsl::LinTerm
+ * - dsl::WorkStealingPool, dsl::FlatTraversal<Derived>
  * - dsl::ModelBuilder<VarEnum, ConEnum>
  * - dsl::MIPCallback, dsl::CallbackSolution, dsl::Progress
  *
  * Free functions:
- * - dsl::range(), dsl::range_view(), dsl::filter()
- * - dsl::sum()
- * - dsl::value(), dsl::values(), dsl::valueAt(), dsl::valuesWithIndex()
+ * - dsl::range(), dsl::range_view(), dsl::intervals(), dsl::filter(), dsl::filter_on<D>(), dsl::filter_batch(), dsl::cached(), dsl::group_by<Dim>()
+ * - dsl::sum(), dsl::term(), dsl::parallel_for(), dsl::parallel_sum()
+ * - dsl::value(), dsl::values(), dsl::valueAt(), dsl::valuesWithIndex(), dsl::getAttr()
  * - dsl::fix(), dsl::unfix(), dsl::setStart(), dsl::fixAll(), dsl::setStartAll()
- * - dsl::lb(), dsl::ub(), dsl::setLB(), dsl::setUB()
+ * - dsl::lb(), dsl::ub(), dsl::setLB(), dsl::setUB(), dsl::setAttr()
  * - dsl::rhs(), dsl::setRHS(), dsl::sense(), dsl::slack(), dsl::dual()
+ * - dsl::slacks(), dsl::duals(), dsl::getAttr(), dsl::setAttr() (bulk constraint attributes)
  * - dsl::statusString(), dsl::computeStatistics(), dsl::computeIIS()
  * - dsl::isLP(), dsl::isMIP(), dsl::modelSummary()
  */
@@ -20,6 +20,8 @@ KEY COMPONENTS
 - sum(Range, VariableGroup): Domain-filtered dense variable summation
 - sum(VariableContainer): Unified summation over dense or sparse containers
 - sum(Range, VariableContainer): Domain-filtered unified container summation
+- LinExprBuilder: Reusable SoA term buffer emitting one GRBLinExpr::addTerms
+- sum(LinExprBuilder&, Range, Func): sum(Range, Func) through a LinExprBuilder
 - quadSum(Range, Func): Domain-based quadratic summation for QP objectives
 - expr_detail::invoke_on_index(): Internal tuple unpacking helper
 - expr_detail::add_term(): Internal term accumulation helper
@@ -56,9 +58,14 @@ USAGE EXAMPLES
     auto expr = dsl::sum(XV);               // All variables in XV
     auto expr = dsl::sum(I, XV);            // Variables for indices in I
 
+    // Reusable term buffer (no temporaries, one addTerms call)
+    dsl::LinExprBuilder b;
+    auto expr = dsl::sum(b, I, [&](int i) { return dsl::term(cost[i], X(i)); });
+
 DEPENDENCIES
 ------------
 � <type_traits>, <utility>, <tuple>, <functional> - Metaprogramming
+� <vector>, <span>, <algorithm>, <climits> - LinExprBuilder buffers
 � gurobi_c++.h - GRBLinExpr, GRBVar types
 � indexing.h - Index domain types, is_tuple_like_v trait
 
@@ -69,6 +76,7 @@ PERFORMANCE NOTES
 � sum(VariableGroup): O(n) where n = total variables in dense structure
 � Memory: No dynamic allocation beyond GRBLinExpr internal growth
 � GRBLinExpr: Amortized O(1) per += operation
+� LinExprBuilder: O(1) push per term into reserved arrays; one addTerms per build
 
 THREAD SAFETY
 -------------
@@ -92,6 +100,10 @@ EXCEPTION SAFETY
 #include <utility>
 #include <tuple>
 #include <functional>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <climits>
 
 #include "gurobi_c++.h"
 #include "indexing.h"
@@ -315,7 +327,7 @@ namespace dsl {
     {
         GRBLinExpr expr = 0.0;
 
-        vSet.forEach([&](const GRBVar& v, const std::vector<int>&) {
+        vSet.forEachVar([&](const GRBVar& v) {
             expr += v;
         });
 
@@ -392,7 +404,7 @@ namespace dsl {
     {
         GRBLinExpr expr = 0.0;
 
-        vc.forEach([&](const GRBVar& v, const std::vector<int>&) {
+        vc.forEachVar([&](const GRBVar& v) {
             expr += v;
         });
 
@@ -437,6 +449,178 @@ namespace dsl {
         return sum(rng, fn);
     }
 
+    // ========================================================================
+    // TERM-BUFFER EXPRESSION BUILDER
+    // ========================================================================
+
+    /**
+     * @brief A single linear term coef * var, collected without building a GRBLinExpr
+     *
+     * @details Returned by dsl::term() so generator lambdas used with a
+     *          LinExprBuilder can hand over (coef, var) pairs directly instead
+     *          of a temporary GRBLinExpr.
+     */
+    struct LinTerm {
+        double coef = 1.0;
+        GRBVar var;
+    };
+
+    /// @brief Make a LinTerm (coef * var) for LinExprBuilder / sum(builder, ...)
+    inline LinTerm term(double coef, const GRBVar& var) {
+        return LinTerm{ coef, var };
+    }
+
+    /**
+     * @brief Reusable structure-of-arrays buffer for building GRBLinExpr
+     *
+     * @details Collects terms into two parallel arrays (coefficients and
+     *          variables) plus a constant, and emits them with a single
+     *          GRBLinExpr::addTerms(coeffs, vars, n) call. clear() keeps the
+     *          capacity, so a builder reused across generator calls stops
+     *          allocating once it has grown to the largest row.
+     *
+     *          Accepted inputs: LinTerm, GRBVar (coef 1), double (constant)
+     *          and GRBLinExpr (terms are copied out one by one).
+     *
+     * @note Not thread-safe; use one builder per thread.
+     *
+     * @example
+     *     dsl::LinExprBuilder row(64);
+     *     auto cap = ConstraintFactory::addIndexed(model, "cap", I, [&](int i) {
+     *         return dsl::sum(row, J, [&](int j) { return dsl::term(a[i][j], X(i, j)); })
+     *             <= b[i];
+     *     });
+     */
+    class LinExprBuilder {
+    public:
+        /// @brief Empty builder
+        LinExprBuilder() = default;
+
+        /// @brief Builder with room for n terms
+        explicit LinExprBuilder(std::size_t n) { reserve(n); }
+
+        /// @brief Reserve room for n terms
+        void reserve(std::size_t n) {
+            coeffs_.reserve(n);
+            vars_.reserve(n);
+        }
+
+        /// @brief Drop all terms and the constant; capacity is kept
+        /// @noexcept
+        void clear() noexcept {
+            coeffs_.clear();
+            vars_.clear();
+            constant_ = 0.0;
+        }
+
+        /// @brief Number of collected terms
+        /// @noexcept
+        [[nodiscard]] std::size_t size() const noexcept { return vars_.size(); }
+
+        /// @brief Returns true if no term was collected
+        /// @noexcept
+        [[nodiscard]] bool empty() const noexcept { return vars_.empty(); }
+
+        /// @brief Accumulated constant
+        /// @noexcept
+        [[nodiscard]] double constant() const noexcept { return constant_; }
+
+        /// @brief Coefficient buffer (parallel to vars())
+        [[nodiscard]] std::span<const double> coeffs() const noexcept { return coeffs_; }
+
+        /// @brief Variable buffer (parallel to coeffs())
+        [[nodiscard]] std::span<const GRBVar> vars() const noexcept { return vars_; }
+
+        /// @brief Append coef * v
+        void add(double coef, const GRBVar& v) {
+            coeffs_.push_back(coef);
+            vars_.push_back(v);
+        }
+
+        /// @brief Append a LinTerm
+        void add(const LinTerm& t) { add(t.coef, t.var); }
+
+        /// @brief Append 1.0 * v
+        void add(const GRBVar& v) { add(1.0, v); }
+
+        /// @brief Add to the constant
+        void add(double c) noexcept { constant_ += c; }
+
+        /// @brief Append every term and the constant of an existing expression
+        void add(const GRBLinExpr& e) {
+            const int n = static_cast<int>(e.size());
+            for (int k = 0; k < n; ++k) {
+                add(e.getCoeff(k), e.getVar(k));
+            }
+            constant_ += e.getConstant();
+        }
+
+        /// @brief Stream-style append (any type accepted by add())
+        template<typename T>
+        LinExprBuilder& operator+=(const T& t) {
+            add(t);
+            return *this;
+        }
+
+        /**
+         * @brief Append the collected terms to an expression
+         * @param expr Target; receives one addTerms() call plus the constant
+         */
+        void appendTo(GRBLinExpr& expr) const {
+            for (std::size_t done = 0; done < vars_.size(); ) {
+                const int n = static_cast<int>(std::min<std::size_t>(
+                    vars_.size() - done, static_cast<std::size_t>(INT_MAX)));
+                expr.addTerms(coeffs_.data() + done, vars_.data() + done, n);
+                done += static_cast<std::size_t>(n);
+            }
+            if (constant_ != 0.0) {
+                expr.addConstant(constant_);
+            }
+        }
+
+        /// @brief Build a new GRBLinExpr from the collected terms
+        [[nodiscard]] GRBLinExpr build() const {
+            GRBLinExpr expr = 0.0;
+            appendTo(expr);
+            return expr;
+        }
+
+    private:
+        std::vector<double> coeffs_;   ///< Term coefficients
+        std::vector<GRBVar> vars_;     ///< Term variables
+        double constant_ = 0.0;        ///< Constant part
+    };
+
+    /**
+     * @brief sum(Range, Func) through a reusable LinExprBuilder
+     *
+     * @details Clears the builder, collects func(idx...) for every element of
+     *          rng into it, and emits the expression with one addTerms() call.
+     *          func may return LinTerm (see dsl::term), GRBVar, double or
+     *          GRBLinExpr; LinTerm and GRBVar avoid any temporary expression.
+     *
+     * @param builder Buffer reused across calls (cleared on entry)
+     * @param rng Index domain to iterate over
+     * @param func Term generator
+     * @return GRBLinExpr equal to sum(rng, func)
+     *
+     * @complexity O(n); no allocation once the builder has enough capacity
+     *
+     * @example
+     *     dsl::LinExprBuilder b;
+     *     auto cost = dsl::sum(b, I * J, [&](int i, int j) {
+     *         return dsl::term(c[i][j], X(i, j));
+     *     });
+     */
+    template<typename Range, typename Func>
+    GRBLinExpr sum(LinExprBuilder& builder, const Range& rng, Func&& func) {
+        builder.clear();
+        for (const auto& idx : rng) {
+            builder.add(expr_detail::invoke_on_index(func, idx));
+        }
+        return builder.build();
+    }
+
     // ========================================================================
     // QUADRATIC SUM FUNCTIONS
     // ========================================================================
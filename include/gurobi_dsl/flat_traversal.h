@@ -0,0 +1,135 @@
+#pragma once
+/*
+===============================================================================
+FLAT TRAVERSAL  Index-free loops shared by the variable and constraint containers
+===============================================================================
+
+OVERVIEW
+--------
+Every container of the DSL stores its Gurobi objects contiguously and exposes
+them as flat(). FlatTraversal is a CRTP base that builds the index-free
+traversals on top of that span once, instead of in each container.
+
+KEY COMPONENTS
+--------------
+ FlatTraversal<Derived>  forEachVar / forEachConstr / forEachFlat over Derived::flat()
+
+DESIGN PHILOSOPHY
+-----------------
+ flat() is the only requirement; containers stay free of loop boilerplate
+ forEachVar() exists only for GRBVar containers, forEachConstr() only for
+  GRBConstr containers
+ Whatever flat() throws (e.g. VariableContainer on an empty container)
+  propagates unchanged
+
+USAGE EXAMPLES
+--------------
+    X.forEachVar([](GRBVar& v) { v.set(GRB_DoubleAttr_Start, 0.0); });
+
+    X.forEachFlat([&](std::size_t k, const GRBVar& v) {
+        start[k] = v.get(GRB_DoubleAttr_X);
+    });
+
+DEPENDENCIES
+------------
+ gurobi_c++.h - GRBVar / GRBConstr element types
+ <span>, <ranges>, <concepts>, <utility>, <cstddef>
+
+PERFORMANCE NOTES
+-----------------
+ Plain loop over the contiguous array: no index tuple, no allocation
+
+THREAD SAFETY
+-------------
+ Same as the container's flat()
+
+EXCEPTION SAFETY
+----------------
+ Propagates exceptions from flat() and from the callback
+
+===============================================================================
+*/
+
+#include <cstddef>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <utility>
+
+#include "gurobi_c++.h"
+
+namespace dsl {
+
+    // ============================================================================
+    // FLAT TRAVERSAL MIXIN
+    // ============================================================================
+    /**
+     * @class FlatTraversal
+     * @brief CRTP base adding index-free traversals to containers with flat()
+     * @tparam Derived Container exposing `std::span<T> flat()` and
+     *                 `std::span<const T> flat() const`
+     *
+     * @details forEachVar() / forEachConstr() call fn(T&) for every element;
+     *          forEachFlat() calls fn(k, T&) with the position k in flat().
+     *          Both run in O(count()) over the contiguous array, without
+     *          computing index tuples. Const containers pass const T&.
+     *
+     * @example
+     *     X.forEachVar([](GRBVar& v) { v.set(GRB_DoubleAttr_Start, 0.0); });
+     *     cap.forEachFlat([&](std::size_t k, const GRBConstr& c) { rows[k] = c; });
+     */
+    template<typename Derived>
+    class FlatTraversal {
+        template<typename D>
+        using element_t = std::ranges::range_value_t<decltype(std::declval<D&>().flat())>;
+
+    public:
+        /// @brief Call fn(GRBVar&) for every variable
+        template<typename Fn, typename D = Derived>
+            requires std::same_as<element_t<D>, GRBVar>
+        void forEachVar(Fn&& fn) { forEachElement(self(), fn); }
+
+        /// @brief Const version of forEachVar()
+        template<typename Fn, typename D = Derived>
+            requires std::same_as<element_t<D>, GRBVar>
+        void forEachVar(Fn&& fn) const { forEachElement(self(), fn); }
+
+        /// @brief Call fn(GRBConstr&) for every constraint
+        template<typename Fn, typename D = Derived>
+            requires std::same_as<element_t<D>, GRBConstr>
+        void forEachConstr(Fn&& fn) { forEachElement(self(), fn); }
+
+        /// @brief Const version of forEachConstr()
+        template<typename Fn, typename D = Derived>
+            requires std::same_as<element_t<D>, GRBConstr>
+        void forEachConstr(Fn&& fn) const { forEachElement(self(), fn); }
+
+        /// @brief Call fn(k, element) with the storage position k in flat()
+        template<typename Fn>
+        void forEachFlat(Fn&& fn) { forEachPosition(self(), fn); }
+
+        /// @brief Const version of forEachFlat()
+        template<typename Fn>
+        void forEachFlat(Fn&& fn) const { forEachPosition(self(), fn); }
+
+    private:
+        Derived& self() noexcept { return static_cast<Derived&>(*this); }
+        const Derived& self() const noexcept { return static_cast<const Derived&>(*this); }
+
+        template<typename Self, typename Fn>
+        static void forEachElement(Self& s, Fn& fn) {
+            for (auto& x : s.flat()) {
+                fn(x);
+            }
+        }
+
+        template<typename Self, typename Fn>
+        static void forEachPosition(Self& s, Fn& fn) {
+            const auto items = s.flat();
+            for (std::size_t k = 0; k < items.size(); ++k) {
+                fn(k, items[k]);
+            }
+        }
+    };
+
+} // namespace dsl
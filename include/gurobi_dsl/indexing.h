@@ -15,10 +15,17 @@ KEY COMPONENTS
  dsl::IndexList  Materialized, ordered list of integer indices (`std::vector<int>`)
  dsl::RangeView / dsl::range_view()  Lazy half-open range [begin, end) with positive step
  dsl::range(begin, end)  Materialized helper for [begin, end)
+ dsl::IntervalSet / dsl::intervals()  Sorted union of [lo, hi) runs stored run-length encoded
+ dsl::Relation<N>  Materialized sparse tuple set (arcs/edges) in CSR form with out()/in() slices
+ dsl::TupleList<N>  Order-preserving materialized tuple list, one int array per dimension
  Set operations on IndexList  `+` union, `&` intersection, `-` difference, `^` symmetric difference
  dsl::Cartesian<Sets...>  Lazy N-dimensional Cartesian product for set-like types
  dsl::Filtered<Product, Pred>  Lazy filtered view over any product
  dsl::filter(...) + operator|  Pipe adaptor that combines predicates with logical AND
+ dsl::filter_on<D>(pred) / dsl::PushdownFiltered  Prefix predicates pruned per Cartesian dimension
+ dsl::filter_batch(...) / dsl::BatchFiltered  Block-wise mask + compaction filter for long scalar domains
+ dsl::group_by<Dim>(...) / dsl::GroupIndex  One-pass key -> contiguous slice index over tuple domains
+ Filtered::materialize() / dsl::cached()  Evaluate a lazy domain once and reuse the store
  Printing utilities (operator<<)  Human-readable formatting
 
 DESIGN PHILOSOPHY
@@ -44,6 +51,13 @@ USAGE EXAMPLES
  Lazy stepped range
     auto R = dsl::range_view(0, 10, 2); // 0,2,4,6,8
 
+ Run-length horizon
+    dsl::IntervalSet T{{0, 24}, {48, 72}}; // two shift windows, 2 runs stored
+
+ Sparse arc set
+    auto A = dsl::Relation<2>::from((V * V) | dsl::filter([](int i, int j){ return i != j; }));
+    for (int j : A.out(0)) { // successors of node 0 // }
+
  Set operations
     auto U = I + K;                // union: keep I's order, add new from K
     auto D = I - dsl::IndexList{3}; // {1, 7}
@@ -54,22 +68,52 @@ USAGE EXAMPLES
  Filtering
     auto even = dsl::range_view(0, 10) | dsl::filter([](int x){ return x % 2 == 0; });
 
+ Per-key slices (flow balance without scanning all arcs per node)
+    auto out = dsl::group_by<0>(arcs);
+    for (auto [i, j] : out[3]) { // arcs leaving 3 // }
+
+ Block-wise filter over a long horizon
+    auto busy = dsl::range_view(0, 1'000'000) | dsl::filter_batch([&](int t){ return load[t] > 0; });
+
+ Evaluate a filtered domain once, reuse it for variables/constraints/objective
+    auto A = dsl::cached((I * K) | dsl::filter([](int i, int k){ return i != k; }));
+
+ Filter pushdown (predicate tested once per i, not per (i, j))
+    auto P = (I * K) | dsl::filter(dsl::filter_on<0>([&](int i){ return open[i]; }));
+
 DEPENDENCIES
 ------------
  <tuple>, <array>, <utility>, <vector>, <initializer_list>, <algorithm>
- <ranges>, <type_traits>, <iterator>, <ostream>
+ <ranges>, <type_traits>, <iterator>, <compare>, <ostream>
+ <atomic>, <memory>, <limits>, <cstdint> - Lazy membership index
+ <span> - Relation adjacency slices
+ <mutex> - One-time materialization in dsl::cached()
 
 PERFORMANCE NOTES
 -----------------
  IndexList: O(1) random access; filtering is linear in size
+ IndexList::contains: O(1) after a lazy bitset/hash index is built (lists > 32 elements);
+  iteration is read-only, and writable()/push_back() drop the index
+ Set operations (+, &, -, ^): O(|A| + |B|), order semantics unchanged
  RangeView: O(1) storage; indexing and iteration are arithmetic-only
+ IntervalSet: O(runs) storage; contains/operator[] O(log runs); set operations O(r1 + r2)
+ Relation<N>: O(N * tuples) storage plus key offsets; out()/in() O(1) for compact key ranges,
+  O(log distinct keys) when ids are sparse (span > 32 slots per tuple); contains adds O(log deg)
  Cartesian: nested-loop indexing; no dynamic allocation per iteration
+ Cartesian random access: rank/unrank/operator[]/iterator += n are O(N)
  Filtered: wraps underlying range; skips non-matching elements lazily
+ BatchFiltered: predicate runs over 256-element blocks into 64-bit masks; kept values are
+  reached by ctz over set bits (empty words skipped, cost scales with the output)
+ group_by: O(n + key span) build (O(n log n) for sparse keys); G[i] is a contiguous slice,
+  found in O(1) (compact keys) or O(log distinct keys)
+ materialize()/cached(): one pass over the lazy domain; later passes read N int arrays
+ Cartesian filters: prefix predicates run once per prefix and skip whole sub-blocks (O(output) for sparse masks)
 
 THREAD SAFETY
 -------------
  All views are value types; concurrent const iteration is safe
  Mutations of underlying containers require external synchronization
+ Cached: concurrent first use is safe (std::call_once); copies share the store
 
 EXCEPTION SAFETY
 ----------------
@@ -83,6 +127,7 @@ EXCEPTION SAFETY
 
 #include <tuple>
 #include <array>
+#include <bit>
 #include <utility>
 #include <vector>
 #include <initializer_list>
@@ -90,10 +135,225 @@ EXCEPTION SAFETY
 #include <ranges>
 #include <type_traits>
 #include <iterator>
+#include <compare>
 #include <ostream>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <cstdint>
+#include <span>
+#include <mutex>
 
 namespace dsl {
 
+    // ============================================================================
+    // MEMBERSHIP INDEX (ACCELERATES IndexList::contains AND SET ALGEBRA)
+    // ============================================================================
+    namespace detail {
+
+        /**
+         * @class IndexMembership
+         * @brief Integer set used to answer "is x in the list?" in O(1)
+         * @details
+         *  Picks one of two layouts from the value span [lo, hi]:
+         *  - Dense bitset when the span needs at most `expected + 16` 64-bit
+         *    words (i.e. values are reasonably packed)
+         *  - Open-addressing flat hash set (linear probing) otherwise
+         *
+         *  Only membership is stored; order and duplicates stay in the list.
+         */
+        class IndexMembership {
+        public:
+            /**
+             * @brief Empty set able to hold values in [lo, hi]
+             * @param lo Smallest value that will be inserted
+             * @param hi Largest value that will be inserted
+             * @param expected Expected number of insertions (sizing hint)
+             */
+            IndexMembership(int lo, int hi, std::size_t expected)
+                : lo_(lo)
+            {
+                const std::uint64_t span = hi >= lo
+                    ? static_cast<std::uint64_t>(static_cast<long long>(hi) - lo) + 1
+                    : 0;
+                const std::uint64_t words = (span + 63) / 64;
+                dense_ = words <= expected + 16;
+                if (dense_) {
+                    bits_.assign(static_cast<std::size_t>(words), 0);
+                }
+                else {
+                    rehash(expected);
+                }
+            }
+
+            /// @brief Build the set of all values in `values`
+            static IndexMembership of(const std::vector<int>& values) {
+                IndexMembership m = sized_for(values, {});
+                for (int x : values) {
+                    m.insert(x);
+                }
+                return m;
+            }
+
+            /// @brief Empty set sized for values drawn from `a` and `b`
+            static IndexMembership sized_for(const std::vector<int>& a, const std::vector<int>& b) {
+                int lo = std::numeric_limits<int>::max();
+                int hi = std::numeric_limits<int>::min();
+                for (int x : a) { lo = std::min(lo, x); hi = std::max(hi, x); }
+                for (int x : b) { lo = std::min(lo, x); hi = std::max(hi, x); }
+                return IndexMembership(lo, hi, a.size() + b.size());
+            }
+
+            /// @brief Returns true if x was inserted
+            /// @noexcept
+            bool contains(int x) const noexcept {
+                if (dense_) {
+                    const long long off = static_cast<long long>(x) - lo_;
+                    if (off < 0 || static_cast<std::uint64_t>(off) >= bits_.size() * 64) {
+                        return false;
+                    }
+                    return (bits_[static_cast<std::size_t>(off >> 6)] >> (off & 63)) & 1u;
+                }
+                for (std::size_t s = slot(x); used_[s]; s = (s + 1) & mask()) {
+                    if (keys_[s] == x) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /**
+             * @brief Insert x
+             * @return true if x was not present before
+             * @pre In bitset mode, x lies in the [lo, hi] given at construction
+             */
+            bool insert(int x) {
+                if (dense_) {
+                    const auto off = static_cast<std::size_t>(static_cast<long long>(x) - lo_);
+                    std::uint64_t& w = bits_[off >> 6];
+                    const std::uint64_t bit = std::uint64_t{ 1 } << (off & 63);
+                    const bool fresh = (w & bit) == 0;
+                    w |= bit;
+                    return fresh;
+                }
+                if (2 * (count_ + 1) > keys_.size()) {
+                    rehash(count_ + 1);
+                }
+                std::size_t s = slot(x);
+                for (; used_[s]; s = (s + 1) & mask()) {
+                    if (keys_[s] == x) {
+                        return false;
+                    }
+                }
+                keys_[s] = x;
+                used_[s] = 1;
+                ++count_;
+                return true;
+            }
+
+            /// @brief Returns true if the bitset layout was chosen
+            /// @noexcept
+            bool dense() const noexcept { return dense_; }
+
+        private:
+            long long                 lo_ = 0;       ///< Bitset: value of bit 0
+            bool                      dense_ = true; ///< Bitset (true) or hash (false)
+            std::vector<std::uint64_t> bits_;        ///< Bitset words
+            std::vector<int>          keys_;         ///< Hash slots
+            std::vector<std::uint8_t> used_;         ///< Hash slot occupancy
+            std::size_t               count_ = 0;    ///< Hash: number of keys
+            int                       shift_ = 64;   ///< Hash: 64 - log2(capacity)
+
+            std::size_t mask() const noexcept { return keys_.size() - 1; }
+
+            std::size_t slot(int x) const noexcept {
+                const std::uint64_t h = static_cast<std::uint64_t>(static_cast<std::uint32_t>(x))
+                    * 0x9e3779b97f4a7c15ull;
+                return static_cast<std::size_t>(h >> shift_);
+            }
+
+            /// @brief Grow the hash table to hold at least n keys at <= 50% load
+            void rehash(std::size_t n) {
+                std::size_t cap = 16;
+                int bits = 4;
+                while (cap < 2 * n) {
+                    cap <<= 1;
+                    ++bits;
+                }
+                std::vector<int> oldKeys = std::move(keys_);
+                std::vector<std::uint8_t> oldUsed = std::move(used_);
+                keys_.assign(cap, 0);
+                used_.assign(cap, 0);
+                shift_ = 64 - bits;
+                count_ = 0;
+                for (std::size_t s = 0; s < oldKeys.size(); ++s) {
+                    if (oldUsed[s]) {
+                        insert(oldKeys[s]);
+                    }
+                }
+            }
+        };
+
+        /**
+         * @class LazyMembership
+         * @brief Lazily built, thread-safe IndexMembership cache owned by an IndexList
+         * @details
+         *  Built on the first get() and published with an atomic compare-exchange,
+         *  so concurrent const callers are safe (a losing builder discards its
+         *  copy). Copies start empty and rebuild on demand; moves transfer the
+         *  cache along with the list's buffer.
+         */
+        class LazyMembership {
+        public:
+            LazyMembership() = default;
+            LazyMembership(const LazyMembership&) noexcept {}
+            LazyMembership(LazyMembership&& o) noexcept
+                : ptr_(o.ptr_.exchange(nullptr)) {
+            }
+            LazyMembership& operator=(const LazyMembership& o) noexcept {
+                if (this != &o) {
+                    reset();
+                }
+                return *this;
+            }
+            LazyMembership& operator=(LazyMembership&& o) noexcept {
+                if (this != &o) {
+                    reset();
+                    ptr_.store(o.ptr_.exchange(nullptr));
+                }
+                return *this;
+            }
+            ~LazyMembership() { reset(); }
+
+            /// @brief Index over `values`, building it on first use
+            const IndexMembership& get(const std::vector<int>& values) const {
+                const IndexMembership* p = ptr_.load(std::memory_order_acquire);
+                if (p == nullptr) {
+                    auto built = std::make_unique<const IndexMembership>(IndexMembership::of(values));
+                    const IndexMembership* expected = nullptr;
+                    if (ptr_.compare_exchange_strong(expected, built.get(),
+                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        p = built.release();
+                    }
+                    else {
+                        p = expected;
+                    }
+                }
+                return *p;
+            }
+
+            /// @brief Drop the cached index (called when the list is mutated)
+            /// @noexcept
+            void reset() noexcept {
+                delete ptr_.exchange(nullptr);
+            }
+
+        private:
+            mutable std::atomic<const IndexMembership*> ptr_{ nullptr };
+        };
+
+    } // namespace detail
+
     // ============================================================================
     // INDEX SET
     // ============================================================================
@@ -104,6 +364,13 @@ namespace dsl {
      *  - Backed by `std::vector<int>`
      *  - Preserves insertion order and allows duplicates
      *  - Does not sort or deduplicate automatically
+     *  - Lists longer than INDEXED_THRESHOLD build a membership index
+     *    (bitset or hash set) on the first contains() call; push_back(),
+     *    writable() and assignment drop it
+     *  - Iteration is read-only (const_iterator) and never touches the index,
+     *    so concurrent range-for and contains() on a shared list are safe; the
+     *    list must not be mutated while it is shared
+     *  - In-place algorithms (std::iota, std::sort, ...) go through writable()
      *
      * This behavior is intentional for reproducibility and mapping indices to
      * external data in modeling DSLs.
@@ -115,8 +382,12 @@ namespace dsl {
     class IndexList {
     private:
         std::vector<int> data_;
+        detail::LazyMembership index_;   ///< Built on first contains() if size() > INDEXED_THRESHOLD
 
     public:
+        /// @brief Lists up to this size answer contains() by linear scan
+        static constexpr std::size_t INDEXED_THRESHOLD = 32;
+
         // ------------------------------------------------------------------------
         // Constructors
         // ------------------------------------------------------------------------
@@ -160,28 +431,34 @@ namespace dsl {
         }
 
         // Optional convenience (not used by tests, but handy for DSL code)
-        void push_back(int v) { data_.push_back(v); }
+        void push_back(int v) { index_.reset(); data_.push_back(v); }
         void reserve(std::size_t n) { data_.reserve(n); }
 
         // ------------------------------------------------------------------------
         // Iteration
         // ------------------------------------------------------------------------
 
-        /// @brief Begin iterator
-        /// @noexcept
-        auto begin() noexcept { return data_.begin(); }
-
-        /// @brief Begin iterator (const)
+        /// @brief Begin iterator (read-only; use writable() to modify elements)
         /// @noexcept
-        auto begin() const noexcept { return data_.begin(); }
+        auto begin() const noexcept { return data_.cbegin(); }
 
-        /// @brief End iterator
+        /// @brief End iterator (read-only)
         /// @noexcept
-        auto end() noexcept { return data_.end(); }
+        auto end() const noexcept { return data_.cend(); }
 
-        /// @brief End iterator (const)
-        /// @noexcept
-        auto end() const noexcept { return data_.end(); }
+        /**
+         * @brief Mutable view of the elements; drops the membership index
+         * @details The index is rebuilt on the next contains(). Finish writing
+         *          through the span before querying the list again.
+         * @example
+         *   dsl::IndexList I(5);
+         *   auto w = I.writable();
+         *   std::iota(w.begin(), w.end(), 0);   // {0,1,2,3,4}
+         */
+        std::span<int> writable() noexcept {
+            index_.reset();
+            return data_;
+        }
 
         // ------------------------------------------------------------------------
         // Basic properties
@@ -196,10 +473,21 @@ namespace dsl {
         /// @noexcept
         bool empty() const noexcept { return data_.empty(); }
 
-        /// @brief Check whether the set contains `value`
-        /// @complexity O(size()) linear search
-        /// @noexcept
+        /**
+         * @brief Check whether the set contains `value`
+         * @complexity O(size()) scan up to INDEXED_THRESHOLD elements; above it,
+         *             O(size()) once to build the index, then O(1)
+         * @note Safe to call concurrently as long as the list is not mutated
+         * @noexcept Falls back to the linear scan if the index cannot be allocated
+         */
         bool contains(int value) const noexcept {
+            if (data_.size() > INDEXED_THRESHOLD) {
+                try {
+                    return index_.get(data_).contains(value);
+                }
+                catch (const std::bad_alloc&) {
+                }
+            }
             return std::find(data_.begin(), data_.end(), value) != data_.end();
         }
 
@@ -253,11 +541,12 @@ namespace dsl {
     // Notes:
     //  - Duplicates *within* a single IndexList are preserved.
     //  - Deduplication is only done across operands for union.
+    //  - All operators are O(|A| + |B|): membership goes through the
+    //    right operand's lazy index (or a local one for union).
     // ============================================================================
 
-    /// Internal helper: membership test consistent with IndexList behavior.
     /// @brief Internal helper: membership test consistent with `IndexList`
-    /// @noexcept
+    /// @note Kept for compatibility; no longer linear for large lists
     inline bool contains_linear(const IndexList& S, int x)
     {
         return S.contains(x);
@@ -276,13 +565,12 @@ namespace dsl {
             out.push_back(x);
 
         // Append elements from B that are not already in A or already added.
+        detail::IndexMembership seen = detail::IndexMembership::sized_for(A.raw(), B.raw());
+        for (int x : A.raw())
+            seen.insert(x);
         for (int x : B.raw()) {
-            if (!contains_linear(A, x)) {
-                // Also check if x is already in out (to handle duplicates in B)
-                bool already_added = std::find(out.begin(), out.end(), x) != out.end();
-                if (!already_added)
-                    out.push_back(x);
-            }
+            if (seen.insert(x))
+                out.push_back(x);
         }
 
         return IndexList(std::move(out));
@@ -523,134 +811,943 @@ namespace dsl {
     }
 
     // ============================================================================
-    // DETAIL NAMESPACE: HELPER UTILITIES FOR CARTESIAN AND FILTERING
+    // INTERVALSET: SORTED RUN-LENGTH DOMAIN OF HALF-OPEN [lo, hi) RUNS
     // ============================================================================
     /**
-     * @internal
-     * Helper utilities used by Cartesian<Sets...> and Filtered<Product,Pred>.
+     * @class IntervalSet
+     * @brief Sorted set of integers stored as disjoint half-open runs [lo, hi)
+     * @details Intended for domains that are unions of contiguous ranges
+     *          (time horizons, shift windows). Storage is O(runs) rather than
+     *          O(elements); runs are kept sorted, non-empty and non-adjacent,
+     *          so iteration is always ascending without duplicates.
      *
-     * A "set-like" type used with Cartesian/Filtered must provide:
-     *   - size()             -> number of elements
-     *   - int operator[](i)  -> logical i-th element
-     *   - begin()/end()      -> for use with filtering and range-for
+     *          Integrates with Cartesian and Filtered via `size()`,
+     *          `operator[]` (O(log r)) and `begin()/end()`.
+     * @example
+     *   dsl::IntervalSet T{{0, 8}, {12, 20}};   // 0..7, 12..19
+     *   T.contains(10);                         // false
+     *   for (auto [t, k] : T * dsl::range_view(0, 3)) { // ... // }
      */
-    namespace detail {
+    class IntervalSet {
+    public:
+        using run_type = std::pair<int, int>;   ///< Half-open run [first, second)
 
         // ------------------------------------------------------------------------
-        // Build tuple<const Sets*...> from references
+        // Iterator
         // ------------------------------------------------------------------------
-        /// @brief Build `tuple<const Sets*...>` from references
-        template<typename... Sets>
-        auto make_pointer_tuple(const Sets&... sets) {
-            return std::tuple<const Sets*...>{ &sets... };
+        class iterator {
+            const run_type* runs_ = nullptr;
+            std::size_t     count_ = 0;
+            std::size_t     run_ = 0;
+            int             value_ = 0;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = int;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const int*;
+            using reference = int;
+
+            iterator() = default;
+
+            iterator(const run_type* runs, std::size_t count, std::size_t run)
+                : runs_(runs)
+                , count_(count)
+                , run_(run)
+                , value_(run < count ? runs[run].first : 0)
+            {
+            }
+
+            /// @brief Dereference current value
+            int operator*() const { return value_; }
+
+            /// @brief Prefix increment (steps into the next run at a run's end)
+            iterator& operator++() {
+                if (++value_ == runs_[run_].second) {
+                    ++run_;
+                    value_ = run_ < count_ ? runs_[run_].first : 0;
+                }
+                return *this;
+            }
+
+            /// @brief Postfix increment
+            iterator operator++(int) {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            /// @brief Equality comparison
+            bool operator==(const iterator& other) const noexcept {
+                return run_ == other.run_ && value_ == other.value_;
+            }
+
+            bool operator!=(const iterator& other) const noexcept {
+                return !(*this == other);
+            }
+        };
+
+    private:
+        std::vector<run_type>    runs_;      ///< Sorted, disjoint, non-adjacent runs
+        std::vector<std::size_t> offsets_;   ///< offsets_[k] = elements before runs_[k]
+        std::size_t              size_ = 0;  ///< Total number of elements
+
+        /// @brief Sort, drop empty runs and merge overlapping/adjacent ones
+        static std::vector<run_type> normalize(std::vector<run_type> runs) {
+            std::erase_if(runs, [](const run_type& r) { return r.second <= r.first; });
+            std::sort(runs.begin(), runs.end());
+            std::vector<run_type> out;
+            out.reserve(runs.size());
+            for (const run_type& r : runs) {
+                if (!out.empty() && r.first <= out.back().second)
+                    out.back().second = std::max(out.back().second, r.second);
+                else
+                    out.push_back(r);
+            }
+            return out;
         }
 
-        // ------------------------------------------------------------------------
-        // Read a tuple<int...> from tuple<const Sets*...> and index array
-        // ------------------------------------------------------------------------
-        /// @brief Read `tuple<int...>` from `tuple<const Sets*...>` and index array
-        template<std::size_t... Is, typename Tuple, typename IndexArray>
-        auto deref_tuple_impl(const Tuple& ptrs,
-            const IndexArray& idx,
-            std::index_sequence<Is...>)
-        {
-            // Each set type must provide:
-            //   int operator[](std::size_t) const;
-            return std::make_tuple((*std::get<Is>(ptrs))[idx[Is]]...);
+        /// @brief Rebuild offsets_ and size_ from runs_
+        void reindex() {
+            offsets_.resize(runs_.size());
+            size_ = 0;
+            for (std::size_t k = 0; k < runs_.size(); ++k) {
+                offsets_[k] = size_;
+                size_ += static_cast<std::size_t>(
+                    static_cast<long long>(runs_[k].second) - runs_[k].first);
+            }
         }
 
-        // ------------------------------------------------------------------------
-        // Compute sizes[] for each dimension
-        // ------------------------------------------------------------------------
-        /// @brief Compute sizes[] for each dimension
-        template<typename Tuple, std::size_t... Is>
-        auto sizes_from_tuple_impl(const Tuple& ptrs, std::index_sequence<Is...>) {
-            return std::array<int, sizeof...(Is)>{
-                static_cast<int>(std::get<Is>(ptrs)->size())...
-            };
+        struct normalized_tag {};
+
+        /// @brief Adopt runs that are already normalized (set-operation results)
+        IntervalSet(std::vector<run_type> runs, normalized_tag)
+            : runs_(std::move(runs))
+        {
+            reindex();
         }
 
-        template<typename... Sets>
-        auto sizes_from_tuple(const std::tuple<const Sets*...>& ptrs) {
-            return sizes_from_tuple_impl(ptrs,
-                std::make_index_sequence<sizeof...(Sets)>{});
+        friend IntervalSet operator+(const IntervalSet&, const IntervalSet&);
+        friend IntervalSet operator&(const IntervalSet&, const IntervalSet&);
+        friend IntervalSet operator-(const IntervalSet&, const IntervalSet&);
+
+    public:
+        IntervalSet() = default;
+
+        /// @brief Construct from runs [lo, hi); runs may overlap or be unsorted
+        IntervalSet(std::initializer_list<run_type> runs)
+            : IntervalSet(std::vector<run_type>(runs))
+        {
         }
 
-        // ------------------------------------------------------------------------
-        // Helper: apply tuple of ints to predicate of arity N
-        // ------------------------------------------------------------------------
-        template<typename Pred, typename Tuple, std::size_t... Is>
-        bool apply_pred_impl(const Pred& pred,
-            const Tuple& t,
-            std::index_sequence<Is...>)
+        /// @brief Construct from runs [lo, hi); runs may overlap or be unsorted
+        explicit IntervalSet(std::vector<run_type> runs)
+            : runs_(normalize(std::move(runs)))
         {
-            return std::apply(pred, t);
+            reindex();
+        }
+
+        /**
+         * @brief Compress arbitrary integer values into runs
+         * @details Values are sorted and deduplicated; consecutive integers
+         *          collapse into a single run.
+         * @complexity O(n log n)
+         */
+        template<std::ranges::input_range R>
+            requires std::is_integral_v<std::ranges::range_value_t<R>>
+        static IntervalSet from_values(const R& values) {
+            std::vector<int> v;
+            for (auto x : values)
+                v.push_back(static_cast<int>(x));
+            std::sort(v.begin(), v.end());
+            v.erase(std::unique(v.begin(), v.end()), v.end());
+
+            std::vector<run_type> runs;
+            for (int x : v) {
+                if (!runs.empty() && runs.back().second == x)
+                    ++runs.back().second;
+                else
+                    runs.emplace_back(x, x + 1);
+            }
+            return IntervalSet(std::move(runs), normalized_tag{});
         }
 
         // ------------------------------------------------------------------------
-        // Trait: detect tuple-like types (have std::tuple_size)
+        // Basic properties
         // ------------------------------------------------------------------------
-        template<typename T, typename = void>
-        struct is_tuple_like : std::false_type {};
+        /// @brief Number of elements (not runs)
+        /// @noexcept
+        std::size_t size()  const noexcept { return size_; }
+        /// @brief Returns true if the set is empty
+        /// @noexcept
+        bool        empty() const noexcept { return size_ == 0; }
+        /// @brief Number of stored runs
+        /// @noexcept
+        std::size_t run_count() const noexcept { return runs_.size(); }
+        /// @brief Read-only access to the normalized runs
+        /// @noexcept
+        const std::vector<run_type>& runs() const noexcept { return runs_; }
+
+        /// @brief Add the run [lo, hi), merging with existing runs
+        /// @complexity O(run_count())
+        void add(int lo, int hi) {
+            if (hi <= lo) return;
+            std::vector<run_type> runs = std::move(runs_);
+            runs.emplace_back(lo, hi);
+            runs_ = normalize(std::move(runs));
+            reindex();
+        }
 
-        template<typename T>
-        struct is_tuple_like<T, std::void_t<decltype(std::tuple_size<T>::value)>>
-            : std::true_type {
-        };
+        /// @brief Check whether the set contains `value`
+        /// @complexity O(log run_count())
+        /// @noexcept
+        bool contains(int value) const noexcept {
+            auto it = std::upper_bound(runs_.begin(), runs_.end(), value,
+                [](int v, const run_type& r) { return v < r.first; });
+            return it != runs_.begin() && value < std::prev(it)->second;
+        }
 
-        template<typename T>
-        inline constexpr bool is_tuple_like_v = is_tuple_like<T>::value;
+        /// @brief Random access by logical index (ascending order)
+        /// @complexity O(log run_count())
+        int operator[](std::size_t i) const {
+            const auto k = static_cast<std::size_t>(
+                std::upper_bound(offsets_.begin(), offsets_.end(), i) - offsets_.begin()) - 1;
+            return static_cast<int>(runs_[k].first + static_cast<long long>(i - offsets_[k]));
+        }
+
+        /// @brief Materialize all elements as an IndexList
+        IndexList to_index_list() const {
+            std::vector<int> v;
+            v.reserve(size_);
+            for (const run_type& r : runs_)
+                for (int x = r.first; x < r.second; ++x)
+                    v.push_back(x);
+            return IndexList(std::move(v));
+        }
 
         // ------------------------------------------------------------------------
-        // Apply predicate either to a tuple<int...> (expanded) or scalar (int)
+        // Iteration
         // ------------------------------------------------------------------------
-        /// @brief Apply predicate to a tuple<int...> or scalar int
-        template<typename Pred, typename T>
-        bool apply_pred(const Pred& pred, const T& value)
-        {
-            using U = std::remove_cvref_t<T>;
-
-            if constexpr (is_tuple_like_v<U>) {
-                constexpr std::size_t N = std::tuple_size_v<U>;
-                return apply_pred_impl(pred, value,
-                    std::make_index_sequence<N>{});
-            }
-            else {
-                // Scalar case (e.g., int from IndexList / RangeView)
-                return pred(value);
-            }
-        }
+        /// @brief Begin iterator
+        iterator begin() const { return iterator(runs_.data(), runs_.size(), 0); }
+        /// @brief End iterator
+        iterator end()   const { return iterator(runs_.data(), runs_.size(), runs_.size()); }
 
         // ------------------------------------------------------------------------
-        // Combine multiple predicates into a single AND predicate
+        // Filtering support (reuse Filtered<T,Pred>)
         // ------------------------------------------------------------------------
-        /// @brief Combine multiple predicates into a single AND predicate
+        /// @brief Create a lazy filtered view of this set
         template<typename... Preds>
-        struct PredAll {
-            std::tuple<Preds...> preds;
-
-            template<typename... Args>
-            bool operator()(const Args&... args) const {
-                return std::apply(
-                    [&](auto const&... ps) {
-                        return (ps(args...) && ...);
-                    },
-                    preds
-                );
-            }
-        };
+        auto filter(const Preds&... preds) const;
+    };
 
-    } // namespace detail
+    /// @brief Convenience helper: build an `IntervalSet` from runs [lo, hi)
+    inline IntervalSet intervals(std::initializer_list<IntervalSet::run_type> runs) {
+        return IntervalSet(runs);
+    }
 
     // ============================================================================
-    // Cartesian<Sets...>: LAZY N-DIMENSIONAL CARTESIAN PRODUCT
+    // SET OPERATIONS FOR IntervalSet
     // ============================================================================
-    /**
-     * @class Cartesian
-     * @brief Lazy N-dimensional Cartesian product of set-like objects
+    //
+    // All operands and results are normalized run lists, so every operator is a
+    // single O(r1 + r2) sweep over the runs and never touches individual
+    // elements. Results are ascending (IntervalSet has no insertion order).
+    // ============================================================================
+
+    /// @brief Union operator: `A + B`
+    inline IntervalSet operator+(const IntervalSet& A, const IntervalSet& B)
+    {
+        const auto& a = A.runs_;
+        const auto& b = B.runs_;
+        std::vector<IntervalSet::run_type> out;
+        out.reserve(a.size() + b.size());
+
+        std::size_t i = 0, j = 0;
+        while (i < a.size() || j < b.size()) {
+            const auto& r = (j == b.size() || (i < a.size() && a[i].first <= b[j].first))
+                ? a[i++] : b[j++];
+            if (!out.empty() && r.first <= out.back().second)
+                out.back().second = std::max(out.back().second, r.second);
+            else
+                out.push_back(r);
+        }
+        return IntervalSet(std::move(out), IntervalSet::normalized_tag{});
+    }
+
+    /// @brief Intersection operator: `A & B`
+    inline IntervalSet operator&(const IntervalSet& A, const IntervalSet& B)
+    {
+        const auto& a = A.runs_;
+        const auto& b = B.runs_;
+        std::vector<IntervalSet::run_type> out;
+
+        std::size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            const int lo = std::max(a[i].first, b[j].first);
+            const int hi = std::min(a[i].second, b[j].second);
+            if (lo < hi)
+                out.emplace_back(lo, hi);
+            if (a[i].second < b[j].second) ++i; else ++j;
+        }
+        return IntervalSet(std::move(out), IntervalSet::normalized_tag{});
+    }
+
+    /// @brief Difference operator: `A - B`
+    inline IntervalSet operator-(const IntervalSet& A, const IntervalSet& B)
+    {
+        const auto& b = B.runs_;
+        std::vector<IntervalSet::run_type> out;
+
+        std::size_t j = 0;
+        for (auto [lo, hi] : A.runs_) {
+            while (j < b.size() && b[j].second <= lo)
+                ++j;
+            // Carve out every B run overlapping [lo, hi); B runs may span
+            // several A runs, so j is not advanced past the last overlap.
+            std::size_t k = j;
+            while (lo < hi && k < b.size() && b[k].first < hi) {
+                if (b[k].first > lo)
+                    out.emplace_back(lo, b[k].first);
+                lo = std::max(lo, b[k].second);
+                ++k;
+            }
+            if (lo < hi)
+                out.emplace_back(lo, hi);
+        }
+        return IntervalSet(std::move(out), IntervalSet::normalized_tag{});
+    }
+
+    /// @brief Symmetric difference: `A ^ B = (A - B) + (B - A)`
+    inline IntervalSet operator^(const IntervalSet& A, const IntervalSet& B)
+    {
+        return (A - B) + (B - A);
+    }
+
+    namespace detail {
+
+        /**
+         * @class KeyOffsets
+         * @brief CSR block offsets of entries grouped by an int key
+         * @details Counts the entries of each key and prefix-sums the counts,
+         *          so the entries with key x occupy [block(x).first,
+         *          block(x).second) of a key-ordered array. Keys spanning at
+         *          most DENSE_SLOTS_PER_KEY values per entry get one slot per
+         *          value in [min, max] and an O(1) lookup. Sparser keys
+         *          (e.g. external node ids) keep their sorted distinct values
+         *          and are found by binary search, so memory stays O(entries).
+         */
+        class KeyOffsets {
+        public:
+            /// @brief Dense slots allowed per entry (the TupleIndex::densify() cutoff)
+            static constexpr std::size_t DENSE_SLOTS_PER_KEY = 32;
+            /// @brief Returned by slot() for absent keys
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+            KeyOffsets() = default;
+
+            /// @brief Count `keys` (any order) into per-key blocks
+            explicit KeyOffsets(std::span<const int> keys) {
+                if (keys.empty())
+                    return;
+                const auto [mn, mx] = std::minmax_element(keys.begin(), keys.end());
+                const auto span = static_cast<std::uint64_t>(static_cast<long long>(*mx) - *mn) + 1;
+                if (span <= static_cast<std::uint64_t>(DENSE_SLOTS_PER_KEY) * keys.size()) {
+                    lo_ = *mn;
+                    off_.assign(static_cast<std::size_t>(span) + 1, 0);
+                }
+                else {
+                    dense_ = false;
+                    distinct_.assign(keys.begin(), keys.end());
+                    std::sort(distinct_.begin(), distinct_.end());
+                    distinct_.erase(std::unique(distinct_.begin(), distinct_.end()), distinct_.end());
+                    off_.assign(distinct_.size() + 1, 0);
+                }
+                for (int x : keys)
+                    ++off_[slot(x) + 1];
+                for (std::size_t s = 0; s + 1 < off_.size(); ++s)
+                    off_[s + 1] += off_[s];
+            }
+
+            /// @brief Slot of key x, or npos if no entry has it
+            /// @complexity O(1) dense, O(log slots()) sparse
+            std::size_t slot(int x) const noexcept {
+                if (dense_) {
+                    const long long v = static_cast<long long>(x) - lo_;
+                    if (v < 0 || static_cast<std::size_t>(v) + 1 >= off_.size())
+                        return npos;
+                    return static_cast<std::size_t>(v);
+                }
+                const auto it = std::lower_bound(distinct_.begin(), distinct_.end(), x);
+                if (it == distinct_.end() || *it != x)
+                    return npos;
+                return static_cast<std::size_t>(it - distinct_.begin());
+            }
+
+            /// @brief Entry range [first, second) of key x (empty if absent)
+            std::pair<std::size_t, std::size_t> block(int x) const noexcept {
+                const std::size_t s = slot(x);
+                if (s == npos)
+                    return { 0, 0 };
+                return { off_[s], off_[s + 1] };
+            }
+
+            /// @brief Number of slots (values of [min, max] or distinct keys)
+            /// @noexcept
+            std::size_t slots() const noexcept { return off_.size() - 1; }
+            /// @brief Key of slot s
+            /// @noexcept
+            int key(std::size_t s) const noexcept {
+                return dense_ ? static_cast<int>(static_cast<long long>(lo_) + static_cast<long long>(s)) : distinct_[s];
+            }
+            /// @brief Number of entries in slot s
+            /// @noexcept
+            std::size_t count(std::size_t s) const noexcept { return off_[s + 1] - off_[s]; }
+            /// @brief First entry of every slot (scatter cursors for a counting sort)
+            std::vector<std::size_t> starts() const { return { off_.begin(), off_.end() - 1 }; }
+            /// @brief Returns true if slots are indexed by value (no binary search)
+            /// @noexcept
+            bool dense() const noexcept { return dense_; }
+
+        private:
+            int                      lo_ = 0;       ///< Dense: key of slot 0
+            bool                     dense_ = true; ///< One slot per value in [min, max]
+            std::vector<int>         distinct_;     ///< Sparse: sorted distinct keys
+            std::vector<std::size_t> off_{ 0 };     ///< Slot s: entries [off_[s], off_[s + 1])
+        };
+
+    } // namespace detail
+
+    // ============================================================================
+    // RELATION<N>: MATERIALIZED SPARSE TUPLE SET IN CSR FORM
+    // ============================================================================
+    /**
+     * @class Relation
+     * @brief Sorted, duplicate-free set of N-tuples stored in CSR form
+     * @details Intended for sparse index sets such as arcs/edges, which would
+     *          otherwise be expressed as `(N * N) | dsl::filter(...)` and
+     *          re-scanned on every pass.
+     *
+     *          Components are stored column-wise (one contiguous int array per
+     *          dimension) in lexicographic tuple order, and the tuples
+     *          starting with i form one contiguous block. Block offsets are
+     *          indexed by value when the first components span a compact
+     *          range (O(1) lookup), and by sorted distinct value otherwise
+     *          (O(log k); e.g. sparse external node ids), see
+     *          detail::KeyOffsets. For N == 2 a transposed CSR additionally
+     *          answers in(j) the same way.
+     *
+     *          Iteration yields `std::tuple<int, ...>` like Cartesian, so a
+     *          Relation can be passed to sum(), filter(), parallel_for() and
+     *          the constraint/variable factories. It is a random-access range.
+     *
+     * @tparam N Tuple arity (>= 2)
+     * @example
+     *   auto A = dsl::Relation<2>::from((V * V) | dsl::filter(allowed));
+     *   for (int j : A.out(i)) { ... }            // successors of i, O(deg)
+     *   for (auto [i, j] : A) { ... }             // all arcs, sorted
+     */
+    template<std::size_t N>
+    class Relation {
+        static_assert(N >= 2, "Relation<N>: arity must be at least 2");
+
+    public:
+        using tuple_type = decltype(std::tuple_cat(std::declval<std::array<int, N>>()));
+        using key_type = std::array<int, N>;
+
+        // ------------------------------------------------------------------------
+        // Iterator (random access by rank)
+        // ------------------------------------------------------------------------
+        class iterator {
+            const Relation* rel_ = nullptr;
+            std::size_t     k_ = 0;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = tuple_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            iterator() = default;
+            iterator(const Relation* rel, std::size_t k) : rel_(rel), k_(k) {}
+
+            /// @brief Dereference -> tuple<int,...> with N components
+            value_type operator*() const { return (*rel_)[k_]; }
+            value_type operator[](difference_type n) const { return (*rel_)[k_ + static_cast<std::size_t>(n)]; }
+
+            iterator& operator++() { ++k_; return *this; }
+            iterator  operator++(int) { iterator t = *this; ++k_; return t; }
+            iterator& operator--() { --k_; return *this; }
+            iterator  operator--(int) { iterator t = *this; --k_; return t; }
+            iterator& operator+=(difference_type n) { k_ = static_cast<std::size_t>(static_cast<difference_type>(k_) + n); return *this; }
+            iterator& operator-=(difference_type n) { return *this += -n; }
+
+            friend iterator operator+(iterator it, difference_type n) { return it += n; }
+            friend iterator operator+(difference_type n, iterator it) { return it += n; }
+            friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const iterator& a, const iterator& b) noexcept {
+                return static_cast<difference_type>(a.k_) - static_cast<difference_type>(b.k_);
+            }
+
+            bool operator==(const iterator& o) const noexcept { return k_ == o.k_; }
+            bool operator!=(const iterator& o) const noexcept { return k_ != o.k_; }
+            auto operator<=>(const iterator& o) const noexcept { return k_ <=> o.k_; }
+        };
+
+    private:
+        std::array<std::vector<int>, N> cols_;      ///< cols_[d][k] = component d of tuple k
+        detail::KeyOffsets       outOffsets_;       ///< Rank block of each first component
+        detail::KeyOffsets       inOffsets_;        ///< N == 2: transposed CSR offsets (by second)
+        std::vector<int>         inSources_;        ///< N == 2: first components grouped by second
+
+        /// @brief Block [lo, hi) of tuples whose first component is i
+        std::pair<std::size_t, std::size_t> block(int i) const noexcept {
+            return outOffsets_.block(i);
+        }
+
+    public:
+        Relation() = default;
+
+        /// @brief Build from tuples in any order; duplicates are removed
+        explicit Relation(std::vector<key_type> tuples) {
+            std::sort(tuples.begin(), tuples.end());
+            tuples.erase(std::unique(tuples.begin(), tuples.end()), tuples.end());
+
+            for (std::size_t d = 0; d < N; ++d) {
+                cols_[d].reserve(tuples.size());
+                for (const key_type& t : tuples)
+                    cols_[d].push_back(t[d]);
+            }
+            if (tuples.empty())
+                return;
+            outOffsets_ = detail::KeyOffsets(cols_[0]);
+
+            if constexpr (N == 2) {
+                // Counting sort by second component; stable, so sources stay ascending
+                inOffsets_ = detail::KeyOffsets(cols_[1]);
+                inSources_.resize(tuples.size());
+                std::vector<std::size_t> fill = inOffsets_.starts();
+                for (std::size_t k = 0; k < tuples.size(); ++k)
+                    inSources_[fill[inOffsets_.slot(cols_[1][k])]++] = cols_[0][k];
+            }
+        }
+
+        /// @brief Build from tuples; duplicates are removed
+        Relation(std::initializer_list<key_type> tuples)
+            : Relation(std::vector<key_type>(tuples)) {
+        }
+
+        /**
+         * @brief Materialize any domain yielding N-tuples of ints
+         * @details Typical use: `Relation<2>::from((V * V) | dsl::filter(p))`;
+         *          the predicate is evaluated once here instead of on every pass.
+         */
+        template<typename Domain>
+        static Relation from(const Domain& domain) {
+            std::vector<key_type> tuples;
+            for (const auto& t : domain) {
+                static_assert(std::tuple_size_v<std::remove_cvref_t<decltype(t)>> == N,
+                    "Relation<N>::from: domain must yield N-tuples");
+                tuples.push_back(std::apply([](auto... xs) { return key_type{ static_cast<int>(xs)... }; }, t));
+            }
+            return Relation(std::move(tuples));
+        }
+
+        // ------------------------------------------------------------------------
+        // Basic properties and random access
+        // ------------------------------------------------------------------------
+        /// @brief Number of tuples
+        /// @noexcept
+        std::size_t size()  const noexcept { return cols_[0].size(); }
+        /// @brief Returns true if the relation is empty
+        /// @noexcept
+        bool        empty() const noexcept { return cols_[0].empty(); }
+
+        /// @brief Tuple with rank k (lexicographic order)
+        tuple_type operator[](std::size_t k) const {
+            return [&]<std::size_t... Ds>(std::index_sequence<Ds...>) {
+                return tuple_type{ cols_[Ds][k]... };
+            }(std::make_index_sequence<N>{});
+        }
+
+        /// @brief Contiguous array of component d over all tuples (rank order)
+        /// @noexcept
+        std::span<const int> column(std::size_t d) const noexcept { return cols_[d]; }
+
+        /// @brief Begin iterator
+        iterator begin() const { return iterator(this, 0); }
+        /// @brief End iterator
+        iterator end()   const { return iterator(this, size()); }
+
+        // ------------------------------------------------------------------------
+        // Adjacency and membership
+        // ------------------------------------------------------------------------
+        /**
+         * @brief Second components of the tuples starting with i (ascending for N == 2)
+         * @complexity O(1); O(log k) over k distinct first components if they are sparse
+         * @note For N > 2 the slice is aligned with outRange(i); use column()
+         *       for the remaining components.
+         */
+        std::span<const int> out(int i) const noexcept {
+            auto [lo, hi] = block(i);
+            return std::span<const int>(cols_[1]).subspan(lo, hi - lo);
+        }
+
+        /// @brief Rank range [first, second) of the tuples starting with i
+        /// @complexity Same as out()
+        std::pair<std::size_t, std::size_t> outRange(int i) const noexcept { return block(i); }
+
+        /**
+         * @brief First components of the pairs ending in j (ascending)
+         * @complexity O(1); O(log k) over k distinct second components if they are sparse
+         */
+        std::span<const int> in(int j) const noexcept requires (N == 2) {
+            auto [lo, hi] = inOffsets_.block(j);
+            return std::span<const int>(inSources_).subspan(lo, hi - lo);
+        }
+
+        /// @brief Number of tuples starting with i
+        /// @noexcept
+        std::size_t outDegree(int i) const noexcept { auto [lo, hi] = block(i); return hi - lo; }
+        /// @brief Number of pairs ending in j
+        /// @noexcept
+        std::size_t inDegree(int j) const noexcept requires (N == 2) { return in(j).size(); }
+
+        /**
+         * @brief Check whether a tuple belongs to the relation
+         * @complexity out() block lookup + O(log deg) binary search
+         */
+        bool contains(const key_type& t) const noexcept {
+            auto [lo, hi] = block(t[0]);
+            while (lo < hi) {
+                const std::size_t mid = lo + (hi - lo) / 2;
+                int cmp = 0;
+                for (std::size_t d = 1; d < N && cmp == 0; ++d)
+                    cmp = cols_[d][mid] < t[d] ? -1 : (cols_[d][mid] > t[d] ? 1 : 0);
+                if (cmp == 0) return true;
+                if (cmp < 0) lo = mid + 1; else hi = mid;
+            }
+            return false;
+        }
+
+        /// @brief Variadic membership test: contains(i, j, ...)
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        bool contains(I... idx) const noexcept {
+            return contains(key_type{ static_cast<int>(idx)... });
+        }
+
+        // ------------------------------------------------------------------------
+        // Filtering support (reuse Filtered<T,Pred>)
+        // ------------------------------------------------------------------------
+        /// @brief Create a lazy filtered view of this relation
+        template<typename... Preds>
+        auto filter(const Preds&... preds) const;
+    };
+
+    // ============================================================================
+    // TupleList<N>: MATERIALIZED N-TUPLE DOMAIN (STRUCTURE OF ARRAYS)
+    // ============================================================================
+    /**
+     * @class TupleList
+     * @brief Ordered list of N-tuples stored one int array per dimension
+     * @details The materialized form of a tuple-valued lazy domain (filtered
+     *          products, see Filtered::materialize() and dsl::cached()).
+     *          Unlike Relation<N>, the insertion order is kept and nothing is
+     *          sorted or deduplicated, so iterating a TupleList built from a
+     *          domain visits exactly the tuples the domain would, in the same
+     *          order.
+     *
+     *          Iteration yields `std::tuple<int, ...>`; it is a random-access
+     *          range and plugs into sum(), filter() and the factories.
+     *
+     * @tparam N Tuple arity (>= 2)
+     * @example
+     *   auto T = ((I * J) | dsl::filter(p)).materialize();   // TupleList<2>
+     *   for (auto [i, j] : T) { ... }                        // no predicate calls
+     */
+    template<std::size_t N>
+    class TupleList {
+        static_assert(N >= 2, "TupleList<N>: arity must be at least 2");
+
+    public:
+        using tuple_type = decltype(std::tuple_cat(std::declval<std::array<int, N>>()));
+        using key_type = std::array<int, N>;
+
+        // ------------------------------------------------------------------------
+        // Iterator (random access by position)
+        // ------------------------------------------------------------------------
+        class iterator {
+            const TupleList* list_ = nullptr;
+            std::size_t      k_ = 0;
+
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = tuple_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            iterator() = default;
+            iterator(const TupleList* list, std::size_t k) : list_(list), k_(k) {}
+
+            /// @brief Dereference -> tuple<int,...> with N components
+            value_type operator*() const { return (*list_)[k_]; }
+            value_type operator[](difference_type n) const { return (*list_)[k_ + static_cast<std::size_t>(n)]; }
+
+            iterator& operator++() { ++k_; return *this; }
+            iterator  operator++(int) { iterator t = *this; ++k_; return t; }
+            iterator& operator--() { --k_; return *this; }
+            iterator  operator--(int) { iterator t = *this; --k_; return t; }
+            iterator& operator+=(difference_type n) { k_ = static_cast<std::size_t>(static_cast<difference_type>(k_) + n); return *this; }
+            iterator& operator-=(difference_type n) { return *this += -n; }
+
+            friend iterator operator+(iterator it, difference_type n) { return it += n; }
+            friend iterator operator+(difference_type n, iterator it) { return it += n; }
+            friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+            friend difference_type operator-(const iterator& a, const iterator& b) noexcept {
+                return static_cast<difference_type>(a.k_) - static_cast<difference_type>(b.k_);
+            }
+
+            bool operator==(const iterator& o) const noexcept { return k_ == o.k_; }
+            bool operator!=(const iterator& o) const noexcept { return k_ != o.k_; }
+            auto operator<=>(const iterator& o) const noexcept { return k_ <=> o.k_; }
+        };
+
+    private:
+        std::array<std::vector<int>, N> cols_;      ///< cols_[d][k] = component d of tuple k
+
+    public:
+        TupleList() = default;
+
+        /// @brief Build from tuples; order and duplicates are kept
+        TupleList(std::initializer_list<key_type> tuples) {
+            reserve(tuples.size());
+            for (const key_type& t : tuples)
+                push_back(t);
+        }
+
+        /**
+         * @brief Materialize any domain yielding N-tuples of ints
+         * @details Evaluates the domain once; lazy predicates are not called
+         *          again when the TupleList is iterated.
+         */
+        template<typename Domain>
+        static TupleList from(const Domain& domain) {
+            TupleList out;
+            if constexpr (requires { domain.size(); })
+                out.reserve(static_cast<std::size_t>(domain.size()));
+            for (const auto& t : domain) {
+                static_assert(std::tuple_size_v<std::remove_cvref_t<decltype(t)>> == N,
+                    "TupleList<N>::from: domain must yield N-tuples");
+                out.push_back(std::apply([](auto... xs) { return key_type{ static_cast<int>(xs)... }; }, t));
+            }
+            return out;
+        }
+
+        /// @brief Append a tuple
+        void push_back(const key_type& t) {
+            for (std::size_t d = 0; d < N; ++d)
+                cols_[d].push_back(t[d]);
+        }
+
+        /// @brief Reserve storage for n tuples in every column
+        void reserve(std::size_t n) {
+            for (auto& c : cols_)
+                c.reserve(n);
+        }
+
+        // ------------------------------------------------------------------------
+        // Basic properties and random access
+        // ------------------------------------------------------------------------
+        /// @brief Number of tuples
+        /// @noexcept
+        std::size_t size()  const noexcept { return cols_[0].size(); }
+        /// @brief Returns true if the list is empty
+        /// @noexcept
+        bool        empty() const noexcept { return cols_[0].empty(); }
+
+        /// @brief Tuple at position k
+        tuple_type operator[](std::size_t k) const {
+            return [&]<std::size_t... Ds>(std::index_sequence<Ds...>) {
+                return tuple_type{ cols_[Ds][k]... };
+            }(std::make_index_sequence<N>{});
+        }
+
+        /// @brief Contiguous array of component d over all tuples
+        /// @noexcept
+        std::span<const int> column(std::size_t d) const noexcept { return cols_[d]; }
+
+        /// @brief Begin iterator
+        iterator begin() const { return iterator(this, 0); }
+        /// @brief End iterator
+        iterator end()   const { return iterator(this, size()); }
+
+        // ------------------------------------------------------------------------
+        // Filtering support (reuse Filtered<T,Pred>)
+        // ------------------------------------------------------------------------
+        /// @brief Create a lazy filtered view of this list
+        template<typename... Preds>
+        auto filter(const Preds&... preds) const;
+    };
+
+    // ============================================================================
+    // DETAIL NAMESPACE: HELPER UTILITIES FOR CARTESIAN AND FILTERING
+    // ============================================================================
+    /**
+     * @internal
+     * Helper utilities used by Cartesian<Sets...> and Filtered<Product,Pred>.
+     *
+     * A "set-like" type used with Cartesian/Filtered must provide:
+     *   - size()             -> number of elements
+     *   - int operator[](i)  -> logical i-th element
+     *   - begin()/end()      -> for use with filtering and range-for
+     */
+    namespace detail {
+
+        // ------------------------------------------------------------------------
+        // Build tuple<const Sets*...> from references
+        // ------------------------------------------------------------------------
+        /// @brief Build `tuple<const Sets*...>` from references
+        template<typename... Sets>
+        auto make_pointer_tuple(const Sets&... sets) {
+            return std::tuple<const Sets*...>{ &sets... };
+        }
+
+        // ------------------------------------------------------------------------
+        // Read a tuple<int...> from tuple<const Sets*...> and index array
+        // ------------------------------------------------------------------------
+        /// @brief Read `tuple<int...>` from `tuple<const Sets*...>` and index array
+        template<std::size_t... Is, typename Tuple, typename IndexArray>
+        auto deref_tuple_impl(const Tuple& ptrs,
+            const IndexArray& idx,
+            std::index_sequence<Is...>)
+        {
+            // Each set type must provide:
+            //   int operator[](std::size_t) const;
+            return std::make_tuple((*std::get<Is>(ptrs))[idx[Is]]...);
+        }
+
+        // ------------------------------------------------------------------------
+        // Compute sizes[] for each dimension
+        // ------------------------------------------------------------------------
+        /// @brief Compute sizes[] for each dimension
+        template<typename Tuple, std::size_t... Is>
+        auto sizes_from_tuple_impl(const Tuple& ptrs, std::index_sequence<Is...>) {
+            return std::array<int, sizeof...(Is)>{
+                static_cast<int>(std::get<Is>(ptrs)->size())...
+            };
+        }
+
+        template<typename... Sets>
+        auto sizes_from_tuple(const std::tuple<const Sets*...>& ptrs) {
+            return sizes_from_tuple_impl(ptrs,
+                std::make_index_sequence<sizeof...(Sets)>{});
+        }
+
+        // ------------------------------------------------------------------------
+        // Helper: apply tuple of ints to predicate of arity N
+        // ------------------------------------------------------------------------
+        template<typename Pred, typename Tuple, std::size_t... Is>
+        bool apply_pred_impl(const Pred& pred,
+            const Tuple& t,
+            std::index_sequence<Is...>)
+        {
+            return std::apply(pred, t);
+        }
+
+        // ------------------------------------------------------------------------
+        // Trait: detect tuple-like types (have std::tuple_size)
+        // ------------------------------------------------------------------------
+        template<typename T, typename = void>
+        struct is_tuple_like : std::false_type {};
+
+        template<typename T>
+        struct is_tuple_like<T, std::void_t<decltype(std::tuple_size<T>::value)>>
+            : std::true_type {
+        };
+
+        template<typename T>
+        inline constexpr bool is_tuple_like_v = is_tuple_like<T>::value;
+
+        // ------------------------------------------------------------------------
+        // Apply predicate either to a tuple<int...> (expanded) or scalar (int)
+        // ------------------------------------------------------------------------
+        /// @brief Apply predicate to a tuple<int...> or scalar int
+        template<typename Pred, typename T>
+        bool apply_pred(const Pred& pred, const T& value)
+        {
+            using U = std::remove_cvref_t<T>;
+
+            if constexpr (is_tuple_like_v<U>) {
+                constexpr std::size_t N = std::tuple_size_v<U>;
+                return apply_pred_impl(pred, value,
+                    std::make_index_sequence<N>{});
+            }
+            else {
+                // Scalar case (e.g., int from IndexList / RangeView)
+                return pred(value);
+            }
+        }
+
+        // ------------------------------------------------------------------------
+        // Combine multiple predicates into a single AND predicate
+        // ------------------------------------------------------------------------
+        /// @brief Combine multiple predicates into a single AND predicate
+        template<typename... Preds>
+        struct PredAll {
+            std::tuple<Preds...> preds;
+
+            template<typename... Args>
+            bool operator()(const Args&... args) const {
+                return std::apply(
+                    [&](auto const&... ps) {
+                        return (ps(args...) && ...);
+                    },
+                    preds
+                );
+            }
+        };
+
+        // ------------------------------------------------------------------------
+        // Materialize a domain: IndexList for ints, TupleList<N> for N-tuples
+        // ------------------------------------------------------------------------
+        /// @brief Evaluate `domain` once into a compact, order-preserving store
+        template<typename Domain>
+        auto materialize_domain(const Domain& domain)
+        {
+            using Value = std::remove_cvref_t<decltype(*std::begin(domain))>;
+            if constexpr (is_tuple_like_v<Value>) {
+                return TupleList<std::tuple_size_v<Value>>::from(domain);
+            }
+            else {
+                std::vector<int> v;
+                if constexpr (requires { domain.size(); })
+                    v.reserve(static_cast<std::size_t>(domain.size()));
+                for (int x : domain)
+                    v.push_back(x);
+                return IndexList(std::move(v));
+            }
+        }
+
+    } // namespace detail
+
+    // ============================================================================
+    // Cartesian<Sets...>: LAZY N-DIMENSIONAL CARTESIAN PRODUCT
+    // ============================================================================
+    /**
+     * @class Cartesian
+     * @brief Lazy N-dimensional Cartesian product of set-like objects
      * @details A set-like type must provide: `size()`, `operator[]`, and
      *          `begin()/end()` for iteration in filters. Iteration order is
      *          lexicographic over dimensions.
+     *
+     *          The product is a `std::ranges::random_access_range`: elements
+     *          can be addressed by linear rank (`operator[]`, `unrank`,
+     *          iterator `+= n`), so a product can be split into equal slices.
      * @example
      *   dsl::IndexList I{1,2};
      *   auto J = dsl::range_view(10, 13); // 10,11,12
@@ -665,48 +1762,76 @@ namespace dsl {
         std::tuple<const Sets*...>   sets_;
 
     public:
+        /// @brief Per-dimension positions into the underlying sets
+        using position_type = std::array<std::size_t, N>;
+
         // ------------------------------------------------------------------------
-        // Iterator for N-dimensional product
+        // Iterator for N-dimensional product (random access)
         // ------------------------------------------------------------------------
+        /**
+         * @class iterator
+         * @brief Random-access iterator over the product in lexicographic order
+         * @details Tracks both the linear rank (for arithmetic and comparison)
+         *          and the per-dimension positions (for O(N) dereference).
+         *          `++`/`--` use the odometer; `+= n` re-derives positions
+         *          from the rank in O(N).
+         */
         class iterator {
             std::tuple<const Sets*...> ptrs_;
-            std::array<int, N>         sizes_;
-            std::array<int, N>         idx_;
+            std::array<int, N>         sizes_{};
+            std::array<int, N>         idx_{};
+            std::size_t                rank_ = 0;
+
+            void seek(std::size_t k) {
+                rank_ = k;
+                std::size_t rest = k;
+                for (int d = static_cast<int>(N) - 1; d > 0; --d) {
+                    const auto sz = static_cast<std::size_t>(sizes_[static_cast<std::size_t>(d)]);
+                    idx_[static_cast<std::size_t>(d)] = sz ? static_cast<int>(rest % sz) : 0;
+                    rest = sz ? rest / sz : 0;
+                }
+                // The first dimension absorbs the overflow: rank == size()
+                // yields {sizes_[0], 0, ...}, the canonical end state.
+                if constexpr (N > 0)
+                    idx_[0] = static_cast<int>(rest);
+            }
 
         public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = decltype(detail::deref_tuple_impl(
+                std::declval<const std::tuple<const Sets*...>&>(),
+                std::declval<const std::array<int, N>&>(),
+                std::make_index_sequence<N>{}));
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
             iterator() = default;
 
-            iterator(const std::tuple<const Sets*...>& ptrs, bool is_end)
+            iterator(const std::tuple<const Sets*...>& ptrs, std::size_t rank)
                 : ptrs_(ptrs)
+                , sizes_(detail::sizes_from_tuple(ptrs))
             {
-                sizes_ = detail::sizes_from_tuple(ptrs_);
-
-                bool any_empty = false;
-                for (std::size_t i = 0; i < N; ++i) {
-                    if (sizes_[i] == 0) {
-                        any_empty = true;
-                        break;
-                    }
-                }
-
-                if (is_end || any_empty) {
-                    idx_.fill(0);
-                    if constexpr (N > 0)
-                        idx_[0] = sizes_[0];
-                    return;
-                }
-
-                idx_.fill(0); // begin state
+                seek(rank);
             }
 
             /// @brief Dereference -> tuple<int,...> with N components
-            auto operator*() const {
+            value_type operator*() const {
                 return detail::deref_tuple_impl(
                     ptrs_, idx_, std::make_index_sequence<N>{});
             }
 
+            /// @brief Element at offset n from this iterator
+            value_type operator[](difference_type n) const { return *(*this + n); }
+
+            /// @brief Linear rank of the current element (size() at end)
+            /// @noexcept
+            std::size_t rank() const noexcept { return rank_; }
+
             /// @brief Prefix ++ (lexicographic "odometer" increment)
             iterator& operator++() {
+                ++rank_;
                 for (int d = static_cast<int>(N) - 1; d >= 0; --d) {
                     ++idx_[static_cast<std::size_t>(d)];
                     if (idx_[static_cast<std::size_t>(d)] < sizes_[static_cast<std::size_t>(d)])
@@ -714,18 +1839,69 @@ namespace dsl {
                     idx_[static_cast<std::size_t>(d)] = 0;
                 }
 
-                // overflow -> end
-                if constexpr (N > 0)
-                    idx_[0] = sizes_[0];
+                // overflow -> end
+                if constexpr (N > 0)
+                    idx_[0] = sizes_[0];
+                return *this;
+            }
+
+            /// @brief Postfix ++
+            iterator operator++(int) {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            /// @brief Prefix -- (odometer decrement)
+            iterator& operator--() {
+                --rank_;
+                for (int d = static_cast<int>(N) - 1; d >= 0; --d) {
+                    if (idx_[static_cast<std::size_t>(d)] > 0 && d > 0) {
+                        --idx_[static_cast<std::size_t>(d)];
+                        return *this;
+                    }
+                    if (d == 0) {
+                        --idx_[0];
+                        return *this;
+                    }
+                    idx_[static_cast<std::size_t>(d)] = sizes_[static_cast<std::size_t>(d)] - 1;
+                }
+                return *this;
+            }
+
+            /// @brief Postfix --
+            iterator operator--(int) {
+                iterator tmp = *this;
+                --(*this);
+                return tmp;
+            }
+
+            /// @brief Advance by n positions in O(N)
+            iterator& operator+=(difference_type n) {
+                seek(static_cast<std::size_t>(static_cast<difference_type>(rank_) + n));
                 return *this;
             }
+            /// @brief Move back by n positions in O(N)
+            iterator& operator-=(difference_type n) { return *this += -n; }
+
+            friend iterator operator+(iterator it, difference_type n) { return it += n; }
+            friend iterator operator+(difference_type n, iterator it) { return it += n; }
+            friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+
+            /// @brief Distance between two iterators of the same product
+            friend difference_type operator-(const iterator& a, const iterator& b) noexcept {
+                return static_cast<difference_type>(a.rank_) - static_cast<difference_type>(b.rank_);
+            }
 
             bool operator==(const iterator& other) const noexcept {
-                return idx_ == other.idx_;
+                return rank_ == other.rank_;
             }
             bool operator!=(const iterator& other) const noexcept {
                 return !(*this == other);
             }
+            auto operator<=>(const iterator& other) const noexcept {
+                return rank_ <=> other.rank_;
+            }
         };
 
         // ------------------------------------------------------------------------
@@ -737,9 +1913,9 @@ namespace dsl {
         }
 
         /// @brief Begin iterator
-        iterator begin() const { return iterator(sets_, false); }
+        iterator begin() const { return iterator(sets_, 0); }
         /// @brief End iterator
-        iterator end()   const { return iterator(sets_, true); }
+        iterator end()   const { return iterator(sets_, size()); }
 
         // Optional helpers: size/empty (not used by tests, but handy)
         /// @brief Total size of the product (materialized count)
@@ -755,6 +1931,49 @@ namespace dsl {
         /// @brief Returns true if any dimension is empty
         bool empty() const { return size() == 0; }
 
+        // ------------------------------------------------------------------------
+        // Random access by linear rank
+        // ------------------------------------------------------------------------
+        /**
+         * @brief Linear (lexicographic) rank of a per-dimension position tuple
+         * @details `pos[d]` is a position in dimension d's set, not a value;
+         *          rank({0,...,0}) == 0 and ranks follow iteration order.
+         * @complexity O(N)
+         */
+        std::size_t rank(const position_type& pos) const {
+            const auto sizes = detail::sizes_from_tuple(sets_);
+            std::size_t k = 0;
+            for (std::size_t d = 0; d < N; ++d)
+                k = k * static_cast<std::size_t>(sizes[d]) + pos[d];
+            return k;
+        }
+
+        /**
+         * @brief Per-dimension positions of the element with linear rank k
+         * @pre k < size()
+         * @complexity O(N)
+         */
+        position_type unrank(std::size_t k) const {
+            const auto sizes = detail::sizes_from_tuple(sets_);
+            position_type pos{};
+            for (int d = static_cast<int>(N) - 1; d >= 0; --d) {
+                const auto sz = static_cast<std::size_t>(sizes[static_cast<std::size_t>(d)]);
+                pos[static_cast<std::size_t>(d)] = k % sz;
+                k /= sz;
+            }
+            return pos;
+        }
+
+        /**
+         * @brief Element (tuple of values) with linear rank k
+         * @pre k < size()
+         * @example
+         *   auto P = I * J;
+         *   auto mid = P.size() / 2;
+         *   for (auto it = P.begin() + mid; it != P.end(); ++it) { // second half // }
+         */
+        auto operator[](std::size_t k) const { return *iterator(sets_, k); }
+
         // ------------------------------------------------------------------------
         // Internal accessor for operator*
         // ------------------------------------------------------------------------
@@ -787,60 +2006,652 @@ namespace dsl {
      * This is created indirectly by calls to:
      *   - IndexList::filter(...)
      *   - RangeView::filter(...)
+     *   - IntervalSet::filter(...)
+     *   - Relation<N>::filter(...)
      *   - Cartesian::filter(...)
      *   - product | dsl::filter(...)
      *
-     * It does not own any indices itself; it simply wraps another range-like
-     * object and skips elements that do not satisfy the predicate.
+     * It does not own any indices itself; it simply wraps another range-like
+     * object and skips elements that do not satisfy the predicate.
+     */
+    /**
+     * @class Filtered
+     * @brief Generic lazy filtering view over any Product
+     * @details Wraps another range-like object and skips elements that do not
+     *          satisfy the predicate. Does not own indices; preserves order.
+     */
+    template<typename Product, typename Pred>
+    class Filtered {
+    private:
+        Product product_;
+        Pred    pred_;
+
+        using UnderIter = decltype(std::declval<const Product&>().begin());
+        using UnderValue = std::remove_cvref_t<decltype(*std::declval<UnderIter>())>;
+
+    public:
+        // ------------------------------------------------------------------------
+        // Iterator
+        // ------------------------------------------------------------------------
+        class iterator {
+            UnderIter   it_;
+            UnderIter   end_;
+            const Pred* pred_;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = UnderValue;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const UnderValue*;
+            using reference = UnderValue;
+
+            iterator() = default;
+
+            iterator(UnderIter it, UnderIter end, const Pred* pred)
+                : it_(it)
+                , end_(end)
+                , pred_(pred)
+            {
+                // Advance to first valid element
+                while (it_ != end_ && !detail::apply_pred(*pred_, *it_))
+                    ++it_;
+            }
+
+            auto operator*() const { return *it_; }
+
+            iterator& operator++()
+            {
+                do { ++it_; } while (it_ != end_ && !detail::apply_pred(*pred_, *it_));
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const noexcept {
+                return it_ == other.it_;
+            }
+            bool operator!=(const iterator& other) const noexcept {
+                return it_ != other.it_;
+            }
+        };
+
+        // ------------------------------------------------------------------------
+        // Constructors + begin/end
+        // ------------------------------------------------------------------------
+        /// @brief Construct filtered view from product and predicate
+        Filtered(const Product& p, const Pred& pred)
+            : product_(p)
+            , pred_(pred)
+        {
+        }
+
+        /// @brief Begin iterator (advanced to first valid element)
+        auto begin() const { return iterator(product_.begin(), product_.end(), &pred_); }
+        /// @brief End iterator
+        auto end()   const { return iterator(product_.end(), product_.end(), &pred_); }
+
+        /**
+         * @brief Evaluate the filter once into a compact store
+         * @return IndexList for scalar products, TupleList<N> for N-tuples,
+         *         in iteration order
+         */
+        auto materialize() const { return detail::materialize_domain(*this); }
+    };
+
+    // ============================================================================
+    // FILTER PUSHDOWN: filter_on<D>(pred) + PushdownFiltered<Product, Preds...>
+    // ============================================================================
+    /**
+     * Predicates over a Cartesian product that only read a prefix of the
+     * dimensions can be tested as soon as that prefix is fixed, instead of
+     * once per full tuple. A failed prefix test skips the whole sub-block
+     * beneath it, so a product of sparse activation masks costs O(output)
+     * rather than O(|I| |J| |K|).
+     *
+     * A predicate is treated as a prefix predicate when either:
+     *   - it is wrapped as dsl::filter_on<D>(pred), in which case `pred`
+     *     receives components 0..D; or
+     *   - it is not callable with all N components but is callable with the
+     *     first k < N of them (arity detection; the smallest such k wins).
+     *
+     * Example:
+     *   auto P = (I * J * K) | dsl::filter(
+     *       dsl::filter_on<0>([&](int i){ return open[i]; }),
+     *       [&](int i, int j){ return link[i][j]; },
+     *       [&](int i, int j, int k){ return cap[i][j][k] > 0; });
+     *
+     * Tuple order and content are identical to the unfused Filtered view.
+     */
+    /**
+     * @struct prefix_pred
+     * @brief Predicate reading only components 0..D of a tuple
+     * @details Callable with any number (> D) of components, so it also works
+     *          inside plain Filtered views; Cartesian filters push it down.
+     */
+    template<std::size_t D, typename Pred>
+    struct prefix_pred {
+        static constexpr std::size_t level = D;
+        Pred pred;
+
+        template<typename... Args>
+        bool operator()(const Args&... args) const {
+            static_assert(sizeof...(Args) > D,
+                "filter_on<D>: the product has fewer than D + 1 dimensions");
+            auto all = std::forward_as_tuple(args...);
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                return static_cast<bool>(pred(std::get<Is>(all)...));
+            }(std::make_index_sequence<D + 1>{});
+        }
+    };
+
+    /// @brief Declare `pred` as depending only on components 0..D
+    template<std::size_t D, typename Pred>
+    auto filter_on(Pred&& pred)
+    {
+        return prefix_pred<D, std::decay_t<Pred>>{ std::forward<Pred>(pred) };
+    }
+
+    namespace detail {
+
+        template<typename T>
+        struct is_prefix_pred : std::false_type {};
+
+        template<std::size_t D, typename Pred>
+        struct is_prefix_pred<prefix_pred<D, Pred>> : std::true_type {};
+
+        template<std::size_t>
+        using int_at = int;
+
+        /// @brief True if `P` is callable as `bool(int, ...)` with K ints
+        template<typename P, std::size_t K>
+        constexpr bool callable_with_ints()
+        {
+            return []<std::size_t... Is>(std::index_sequence<Is...>) {
+                return std::is_invocable_r_v<bool, const P&, int_at<Is>...>;
+            }(std::make_index_sequence<K>{});
+        }
+
+        /// @brief Smallest K in [1, N) such that `P` is callable with K ints
+        template<typename P, std::size_t K, std::size_t N>
+        constexpr std::size_t smallest_prefix_arity()
+        {
+            if constexpr (K >= N)
+                return N;
+            else if constexpr (callable_with_ints<P, K>())
+                return K;
+            else
+                return smallest_prefix_arity<P, K + 1, N>();
+        }
+
+        /// @brief Dimension at which predicate `P` can first be evaluated
+        ///        in an N-dimensional product
+        template<std::size_t N, typename P>
+        constexpr std::size_t pred_level()
+        {
+            if constexpr (is_prefix_pred<P>::value) {
+                static_assert(P::level < N,
+                    "filter_on<D>: the product has fewer than D + 1 dimensions");
+                return P::level;
+            }
+            else if constexpr (callable_with_ints<P, N>())
+                return N - 1;
+            else
+                return smallest_prefix_arity<P, 1, N>() - 1;
+        }
+
+        /// @brief True if any predicate can be tested before the last dimension
+        template<std::size_t N, typename... Preds>
+        inline constexpr bool wants_pushdown_v =
+            ((pred_level<N, Preds>() + 1 < N) || ...);
+
+    } // namespace detail
+
+    /**
+     * @class PushdownFiltered
+     * @brief Filtered view over a Cartesian product with prefix pruning
+     * @details Iterates the odometer depth-first. Each predicate is attached
+     *          to the dimension where its last input component is fixed and
+     *          is evaluated when that dimension advances; on failure the
+     *          remaining inner dimensions are never visited.
+     */
+    template<typename Product, typename... Preds>
+    class PushdownFiltered {
+    private:
+        using Ptrs = std::remove_cvref_t<decltype(std::declval<const Product&>().raw_sets())>;
+        static constexpr std::size_t N = std::tuple_size_v<Ptrs>;
+        static_assert(N > 0, "PushdownFiltered requires a non-empty product");
+
+        Product              product_;
+        std::tuple<Preds...> preds_;
+
+        /// @brief Call predicate `p` with the first K components at `idx`
+        template<std::size_t K, typename P>
+        static bool call_prefix(const P& p, const Ptrs& ptrs, const std::array<int, N>& idx)
+        {
+            return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                if constexpr (detail::is_prefix_pred<P>::value)
+                    return static_cast<bool>(p.pred((*std::get<Is>(ptrs))[idx[Is]]...));
+                else
+                    return static_cast<bool>(p((*std::get<Is>(ptrs))[idx[Is]]...));
+            }(std::make_index_sequence<K>{});
+        }
+
+        /// @brief Evaluate every predicate attached to dimension `d`
+        bool accepts(std::size_t d, const Ptrs& ptrs, const std::array<int, N>& idx) const
+        {
+            return std::apply([&](const auto&... ps) {
+                return ([&](const auto& p) {
+                    using P = std::remove_cvref_t<decltype(p)>;
+                    constexpr std::size_t L = detail::pred_level<N, P>();
+                    return d != L || call_prefix<L + 1>(p, ptrs, idx);
+                }(ps) && ...);
+            }, preds_);
+        }
+
+    public:
+        // ------------------------------------------------------------------------
+        // Iterator
+        // ------------------------------------------------------------------------
+        class iterator {
+            const PushdownFiltered* view_ = nullptr;
+            Ptrs                    ptrs_{};
+            std::array<int, N>      sizes_{};
+            std::array<int, N>      idx_{};
+
+            /// Advance dimension `d` to its next accepted value, resetting and
+            /// re-seeding all inner dimensions; carries outward on exhaustion.
+            void advance(int d)
+            {
+                while (d >= 0) {
+                    const auto ud = static_cast<std::size_t>(d);
+                    do { ++idx_[ud]; } while (idx_[ud] < sizes_[ud] &&
+                                              !view_->accepts(ud, ptrs_, idx_));
+                    if (idx_[ud] == sizes_[ud]) {
+                        --d;                        // sub-block exhausted: carry
+                        continue;
+                    }
+                    int e = d + 1;
+                    for (; e < static_cast<int>(N); ++e) {
+                        const auto ue = static_cast<std::size_t>(e);
+                        idx_[ue] = 0;
+                        while (idx_[ue] < sizes_[ue] && !view_->accepts(ue, ptrs_, idx_))
+                            ++idx_[ue];
+                        if (idx_[ue] == sizes_[ue])
+                            break;
+                    }
+                    if (e == static_cast<int>(N))
+                        return;                     // full tuple accepted
+                    d = e - 1;                      // inner dimension empty: retry
+                }
+                set_end();
+            }
+
+            void set_end() noexcept
+            {
+                idx_.fill(0);
+                idx_[0] = sizes_[0];
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = decltype(detail::deref_tuple_impl(
+                std::declval<const Ptrs&>(),
+                std::declval<const std::array<int, N>&>(),
+                std::make_index_sequence<N>{}));
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            iterator() = default;
+
+            iterator(const PushdownFiltered* view, bool atEnd)
+                : view_(view)
+                , ptrs_(view->product_.raw_sets())
+                , sizes_(detail::sizes_from_tuple(ptrs_))
+            {
+                if (atEnd) {
+                    set_end();
+                }
+                else {
+                    idx_.fill(0);
+                    idx_[0] = -1;
+                    advance(0);
+                }
+            }
+
+            value_type operator*() const {
+                return detail::deref_tuple_impl(ptrs_, idx_, std::make_index_sequence<N>{});
+            }
+
+            iterator& operator++()
+            {
+                advance(static_cast<int>(N) - 1);
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const iterator& other) const noexcept {
+                return idx_ == other.idx_;
+            }
+            bool operator!=(const iterator& other) const noexcept {
+                return idx_ != other.idx_;
+            }
+        };
+
+        // ------------------------------------------------------------------------
+        // Constructors + begin/end
+        // ------------------------------------------------------------------------
+        /// @brief Construct from a Cartesian product and its predicates
+        PushdownFiltered(const Product& p, std::tuple<Preds...> preds)
+            : product_(p)
+            , preds_(std::move(preds))
+        {
+        }
+
+        /// @brief Begin iterator (advanced to first accepted tuple)
+        auto begin() const { return iterator(this, false); }
+        /// @brief End iterator
+        auto end()   const { return iterator(this, true); }
+
+        /// @brief Evaluate the filter once into a TupleList<N> (iteration order)
+        auto materialize() const { return detail::materialize_domain(*this); }
+    };
+
+    // ============================================================================
+    // Cached<Domain>: MATERIALIZE ON FIRST USE, REUSE AFTERWARDS
+    // ============================================================================
+    /**
+     * @class Cached
+     * @brief Domain wrapper that materializes on first iteration
+     * @details A lazy domain (typically `(I * J) | dsl::filter(...)`) reused
+     *          for variables, several constraint families and the objective
+     *          re-runs its predicates over the whole product on every pass.
+     *          Cached evaluates it once, on first use, into an IndexList
+     *          (scalar domains) or a TupleList<N> (tuple domains) and serves
+     *          all later passes from that store.
+     *
+     *          Copies share the store, so handing a Cached to factories that
+     *          take domains by value still evaluates the domain only once.
+     *          The first materialization is guarded by std::call_once, so
+     *          concurrent first use from parallel builders is safe.
+     *
+     *          A scalar Cached is a valid Cartesian factor (`C * J`). Like
+     *          every Cartesian factor it is held by address, so it must
+     *          outlive the product. Its store never moves once built.
+     *
+     * @tparam Domain Wrapped lazy domain (held by value)
+     * @example
+     *   auto A = dsl::cached((V * V) | dsl::filter(allowed));
+     *   auto x = VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "x", A);
+     *   for (auto [i, j] : A) { ... }    // predicate already evaluated
+     */
+    template<typename Domain>
+    class Cached {
+    public:
+        /// @brief Materialized representation (IndexList or TupleList<N>)
+        using store_type = decltype(detail::materialize_domain(std::declval<const Domain&>()));
+
+    private:
+        struct State {
+            std::once_flag    once;
+            std::atomic<bool> ready{ false };
+            store_type        store;
+        };
+
+        Domain                 domain_;
+        std::shared_ptr<State> state_;
+
+    public:
+        /// @brief Wrap a domain; nothing is evaluated yet
+        explicit Cached(const Domain& domain)
+            : domain_(domain)
+            , state_(std::make_shared<State>())
+        {
+        }
+
+        /// @brief Materialized store, built on the first call
+        const store_type& materialize() const {
+            std::call_once(state_->once, [this] {
+                state_->store = detail::materialize_domain(domain_);
+                state_->ready.store(true, std::memory_order_release);
+            });
+            return state_->store;
+        }
+
+        /// @brief True once the wrapped domain has been evaluated
+        /// @noexcept
+        bool materialized() const noexcept {
+            return state_->ready.load(std::memory_order_acquire);
+        }
+
+        /// @brief Number of elements (materializes)
+        std::size_t size() const { return static_cast<std::size_t>(materialize().size()); }
+        /// @brief Returns true if the domain is empty (materializes)
+        bool empty() const { return materialize().empty(); }
+        /// @brief Element k (materializes)
+        auto operator[](std::size_t k) const { return materialize()[k]; }
+
+        /// @brief Begin iterator into the shared store (materializes)
+        auto begin() const { return materialize().begin(); }
+        /// @brief End iterator into the shared store (materializes)
+        auto end()   const { return materialize().end(); }
+
+        /// @brief Create a lazy filtered view over the cached elements
+        template<typename... Preds>
+        auto filter(const Preds&... preds) const;
+    };
+
+    /// @brief Wrap a domain so it is evaluated once and reused: `dsl::cached(D)`
+    template<typename Domain>
+    auto cached(const Domain& domain)
+    {
+        return Cached<Domain>(domain);
+    }
+
+    // ============================================================================
+    // BATCH FILTERING: dsl::filter_batch(...) + BatchFiltered<Product, Pred>
+    // ============================================================================
+    /**
+     * Block-wise filtering for long scalar domains (time horizons, RangeView
+     * over 10^6+ periods). Filtered calls the predicate once per element and
+     * branches on the result. BatchFiltered instead works in fixed blocks:
+     *   1. gather up to BLOCK values (arithmetic for RangeView; a view of the
+     *      storage for IndexList);
+     *   2. evaluate the predicate over the block into 64-bit selection masks;
+     *   3. visit the kept values by count-trailing-zeros over the set bits,
+     *      skipping all-zero words.
+     * The iterator walks the masks lazily and holds no value buffer, so it
+     * stays cheap to copy.
+     *
+     * Two predicate forms are accepted:
+     *   - batch:  void(std::span<const int> xs, std::span<std::uint8_t> keep),
+     *             which must set keep[k] to 0 or 1 for every k;
+     *   - scalar: bool(int), evaluated in a tight loop with no early exit,
+     *             so simple arithmetic or table lookups auto-vectorize.
+     * Predicates with integer multiply/modulo only vectorize cheaply where the
+     * target has 32-bit vector multiplies (SSE4.1/AVX2 builds); on baseline
+     * x86-64 a branch-predictable arithmetic test can stay faster with filter().
+     *
+     * Element order matches Filtered. The predicate may be evaluated up to one
+     * block ahead of the element being visited, so use the plain filter() for
+     * stateful predicates that depend on visit order.
+     *
+     * Example:
+     *   auto T = dsl::range_view(0, 10'000'000)
+     *          | dsl::filter_batch([&](int t) { return demand[t] > 0; });
      */
+    namespace detail {
+
+        /// @brief True if `Pred` has the batch signature (span in, mask out)
+        template<typename Pred>
+        inline constexpr bool is_batch_pred_v =
+            std::is_invocable_v<const Pred&, std::span<const int>, std::span<std::uint8_t>>;
+
+    } // namespace detail
+
     /**
-     * @class Filtered
-     * @brief Generic lazy filtering view over any Product
-     * @details Wraps another range-like object and skips elements that do not
-     *          satisfy the predicate. Does not own indices; preserves order.
+     * @class BatchFiltered
+     * @brief Lazy filtered view over a scalar domain, evaluated block-wise
+     * @details See the section comment above. Holds the product by value,
+     *          like Filtered.
      */
     template<typename Product, typename Pred>
-    class Filtered {
+    class BatchFiltered {
+    public:
+        /// @brief Number of elements gathered and tested per step
+        static constexpr std::size_t BLOCK = 256;
+
     private:
         Product product_;
         Pred    pred_;
 
-        using UnderIter = decltype(std::declval<const Product&>().begin());
-        using UnderValue = std::remove_cvref_t<decltype(*std::declval<UnderIter>())>;
+        /// @brief Mask words per block
+        static constexpr std::size_t WORDS = BLOCK / 64;
+
+        /// @brief Value at product position i
+        int valueAt(std::size_t i) const
+        {
+            if constexpr (std::is_same_v<Product, IndexList>) {
+                return product_.raw()[i];
+            }
+            else {
+                return static_cast<int>(product_[i]);
+            }
+        }
+
+        /**
+         * @brief Evaluate the predicate over [start, start + count) into bit masks
+         * @param mask Receives WORDS words; bit j of mask[w] is element 64 * w + j
+         * @pre count <= BLOCK
+         */
+        void select(std::size_t start, std::size_t count, std::uint64_t* mask) const
+        {
+            alignas(64) int          vals[BLOCK];
+            alignas(64) std::uint8_t keep[BLOCK];
+
+            std::span<const int> xs;
+            if constexpr (std::is_same_v<Product, IndexList>) {
+                xs = std::span<const int>(product_.raw()).subspan(start, count);
+            }
+            else if constexpr (std::is_same_v<Product, RangeView>) {
+                // Arithmetic progression: 32-bit induction instead of 64-bit index math.
+                // Unsigned so the step past the last element (near INT_MAX) wraps
+                // instead of overflowing; every stored value is in range.
+                const auto first = static_cast<std::uint32_t>(product_[start]);
+                const auto step = count > 1
+                    ? static_cast<std::uint32_t>(product_[start + 1]) - first
+                    : std::uint32_t{ 0 };
+                std::uint32_t v = first;
+                for (std::size_t k = 0; k < count; ++k, v += step)
+                    vals[k] = static_cast<int>(v);
+                xs = std::span<const int>(vals, count);
+            }
+            else {
+                for (std::size_t k = 0; k < count; ++k)
+                    vals[k] = product_[start + k];
+                xs = std::span<const int>(vals, count);
+            }
+
+            if constexpr (detail::is_batch_pred_v<Pred>) {
+                pred_(xs, std::span<std::uint8_t>(keep, count));
+                for (std::size_t k = 0; k < count; ++k)
+                    keep[k] = keep[k] != 0;
+            }
+            else {
+                // Tight loop, no early exit: simple predicates auto-vectorize
+                for (std::size_t k = 0; k < count; ++k)
+                    keep[k] = static_cast<std::uint8_t>(pred_(xs[k]) ? 1 : 0);
+            }
+            std::fill(keep + count, keep + BLOCK, std::uint8_t{ 0 });
+
+            // Pack 8 mask bytes (0/1) per multiply: byte b lands in bit b
+            for (std::size_t w = 0; w < WORDS; ++w) {
+                std::uint64_t m = 0;
+                for (std::size_t b = 0; b < 8; ++b) {
+                    const std::uint8_t* p = keep + w * 64 + b * 8;
+                    std::uint64_t bytes = 0;
+                    for (std::size_t i = 0; i < 8; ++i)   // a single load on little-endian targets
+                        bytes |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+                    m |= ((bytes * 0x0102040810204080ull) >> 56) << (b * 8);
+                }
+                mask[w] = m;
+            }
+        }
 
     public:
         // ------------------------------------------------------------------------
-        // Iterator
+        // Iterator (walks the selection masks of one block at a time)
         // ------------------------------------------------------------------------
         class iterator {
-            UnderIter   it_;
-            UnderIter   end_;
-            const Pred* pred_;
+            const BatchFiltered*              view_ = nullptr;
+            std::size_t                       next_ = 0;      ///< First product position not yet selected
+            std::size_t                       base_ = 0;      ///< Product position of bit 0 of bits_
+            std::uint64_t                     bits_ = 0;      ///< Unvisited kept bits of the current word
+            std::size_t                       word_ = WORDS;  ///< Index of the current word in mask_
+            std::array<std::uint64_t, WORDS>  mask_{};        ///< Selection masks of the current block
+
+            /// Move to the next non-empty mask word, selecting further blocks as needed
+            void advance()
+            {
+                const std::size_t n = view_->product_.size();
+                for (;;) {
+                    while (++word_ < WORDS) {
+                        if (mask_[word_] != 0) {
+                            bits_ = mask_[word_];
+                            base_ += 64;
+                            return;
+                        }
+                        base_ += 64;
+                    }
+                    if (next_ >= n) {
+                        base_ = 0;                  // canonical end state
+                        return;
+                    }
+                    const std::size_t m = std::min(BLOCK, n - next_);
+                    view_->select(next_, m, mask_.data());
+                    base_ = next_ - 64;             // pre-decremented for the word loop
+                    next_ += m;
+                    word_ = static_cast<std::size_t>(-1);
+                }
+            }
 
         public:
             using iterator_category = std::forward_iterator_tag;
-            using value_type = UnderValue;
+            using value_type = int;
             using difference_type = std::ptrdiff_t;
-            using pointer = const UnderValue*;
-            using reference = UnderValue;
+            using pointer = const int*;
+            using reference = int;
 
             iterator() = default;
 
-            iterator(UnderIter it, UnderIter end, const Pred* pred)
-                : it_(it)
-                , end_(end)
-                , pred_(pred)
+            iterator(const BatchFiltered* view, std::size_t next)
+                : view_(view)
+                , next_(next)
             {
-                // Advance to first valid element
-                while (it_ != end_ && !detail::apply_pred(*pred_, *it_))
-                    ++it_;
+                advance();
             }
 
-            auto operator*() const { return *it_; }
+            int operator*() const
+            {
+                return view_->valueAt(base_ + static_cast<std::size_t>(std::countr_zero(bits_)));
+            }
 
             iterator& operator++()
             {
-                do { ++it_; } while (it_ != end_ && !detail::apply_pred(*pred_, *it_));
+                bits_ &= bits_ - 1;                 // clear the visited bit
+                if (bits_ == 0)
+                    advance();
                 return *this;
             }
 
@@ -852,29 +2663,236 @@ namespace dsl {
             }
 
             bool operator==(const iterator& other) const noexcept {
-                return it_ == other.it_;
+                return next_ == other.next_ && base_ == other.base_ && bits_ == other.bits_;
             }
             bool operator!=(const iterator& other) const noexcept {
-                return it_ != other.it_;
+                return !(*this == other);
             }
         };
 
         // ------------------------------------------------------------------------
         // Constructors + begin/end
         // ------------------------------------------------------------------------
-        /// @brief Construct filtered view from product and predicate
-        Filtered(const Product& p, const Pred& pred)
+        /// @brief Construct from a scalar product and a batch or scalar predicate
+        BatchFiltered(const Product& p, const Pred& pred)
             : product_(p)
             , pred_(pred)
         {
         }
 
-        /// @brief Begin iterator (advanced to first valid element)
-        auto begin() const { return iterator(product_.begin(), product_.end(), &pred_); }
+        /// @brief Begin iterator (first block selected)
+        auto begin() const { return iterator(this, 0); }
         /// @brief End iterator
-        auto end()   const { return iterator(product_.end(), product_.end(), &pred_); }
+        auto end()   const { return iterator(this, static_cast<std::size_t>(product_.size())); }
+
+        /// @brief Evaluate the filter into an IndexList in one pass
+        IndexList materialize() const
+        {
+            const std::size_t n = static_cast<std::size_t>(product_.size());
+            std::vector<int> out;
+            out.reserve(n);                    // upper bound; untouched pages stay unmapped
+            std::uint64_t mask[WORDS];
+            for (std::size_t start = 0; start < n; start += BLOCK) {
+                select(start, std::min(BLOCK, n - start), mask);
+                for (std::size_t w = 0; w < WORDS; ++w) {
+                    for (std::uint64_t m = mask[w]; m != 0; m &= m - 1) {
+                        out.push_back(valueAt(start + w * 64
+                            + static_cast<std::size_t>(std::countr_zero(m))));
+                    }
+                }
+            }
+            return IndexList(std::move(out));
+        }
+    };
+
+    /**
+     * @struct batch_filter_adaptor
+     * @brief Pipe adaptor produced by dsl::filter_batch(pred)
+     */
+    template<typename Pred>
+    struct batch_filter_adaptor {
+        Pred pred;
+    };
+
+    /// @brief Build a block-wise filter adaptor: `R | dsl::filter_batch(pred)`
+    template<typename Pred>
+    auto filter_batch(Pred&& pred)
+    {
+        return batch_filter_adaptor<std::decay_t<Pred>>{ std::forward<Pred>(pred) };
+    }
+
+    /// @brief Pipe a scalar domain (IndexList, RangeView, IntervalSet, ...)
+    ///        into a BatchFiltered view
+    template<typename Product, typename Pred>
+        requires std::is_convertible_v<decltype(std::declval<const Product&>()[std::size_t{}]), int>
+    auto operator|(const Product& product, const batch_filter_adaptor<Pred>& adaptor)
+    {
+        static_assert(detail::is_batch_pred_v<Pred> || std::is_invocable_r_v<bool, const Pred&, int>,
+            "filter_batch: predicate must be void(span<const int>, span<uint8_t>) or bool(int)");
+        return BatchFiltered<Product, Pred>(product, adaptor.pred);
+    }
+
+    // ============================================================================
+    // GROUP BY: dsl::group_by<Dim>(domain) + GroupIndex<Dim, Elem>
+    // ============================================================================
+    namespace detail {
+
+        /// @brief Element type stored by GroupIndex for a domain reference type
+        /// @details Ints, tuples and by-value views (e.g. the Entry of an
+        ///          IndexedVariableSet) are copied; records the domain yields
+        ///          by reference are referenced by pointer.
+        template<typename Ref, typename Value = std::remove_cvref_t<Ref>>
+        using group_elem_t = std::conditional_t<
+            is_tuple_like_v<Value> || std::is_arithmetic_v<Value> || !std::is_lvalue_reference_v<Ref>,
+            Value, const Value*>;
+
+        /// @brief Component Dim of a domain element (int, tuple or `.index`)
+        template<std::size_t Dim, typename Value>
+        int group_key(const Value& v)
+        {
+            if constexpr (is_tuple_like_v<Value>) {
+                static_assert(Dim < std::tuple_size_v<Value>,
+                    "group_by<Dim>: Dim exceeds the tuple arity");
+                return static_cast<int>(std::get<Dim>(v));
+            }
+            else if constexpr (std::is_arithmetic_v<Value>) {
+                static_assert(Dim == 0, "group_by<Dim>: scalar domains only have Dim 0");
+                return static_cast<int>(v);
+            }
+            else {
+                return static_cast<int>(v.index[Dim]);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @class GroupIndex
+     * @brief Elements of a domain grouped by one component, O(1) per group
+     * @details Built in one pass plus a stable counting sort: the elements
+     *          are stored contiguously ordered by key, keeping domain order
+     *          within each key, and per-key offsets (by value for compact
+     *          key ranges, by sorted distinct key otherwise; see
+     *          detail::KeyOffsets) locate each group. `G[i]` is therefore a
+     *          contiguous slice, so
+     *          `sum(G[i], f)` touches only the tuples whose component Dim is i
+     *          instead of scanning the whole domain per constraint.
+     *
+     *          Elements are copied for int and tuple domains and for domains
+     *          yielding views by value, such as IndexedVariableSet entries
+     *          (grouped on `entry.index[Dim]`; they reference the set, which
+     *          must then outlive the index). Records yielded by reference are
+     *          stored as pointers and the slice yields `const Value&`.
+     *
+     * @tparam Dim  Grouping component
+     * @tparam Elem Stored element (see detail::group_elem_t)
+     * @example
+     *   auto out = dsl::group_by<0>(arcs);     // arcs: (i, j) domain
+     *   auto in  = dsl::group_by<1>(arcs);
+     *   ConstraintFactory::addIndexed(model, "flow", V, [&](int v) {
+     *       return dsl::sum(out[v], [&](int i, int j) { return x(i, j); })
+     *           == dsl::sum(in[v],  [&](int i, int j) { return x(i, j); });
+     *   });
+     */
+    template<std::size_t Dim, typename Elem>
+    class GroupIndex {
+    private:
+        std::vector<Elem>        items_;          ///< Elements ordered by key (stable)
+        detail::KeyOffsets       offsets_;        ///< Slice of items_ for each key
+
+        static constexpr bool by_pointer = std::is_pointer_v<Elem>;
+
+        /// @brief Slice [lo, hi) of items for key
+        std::pair<std::size_t, std::size_t> block(int key) const noexcept {
+            return offsets_.block(key);
+        }
+
+    public:
+        GroupIndex() = default;
+
+        /// @brief Group the elements of `domain` by component Dim
+        template<typename Domain>
+        explicit GroupIndex(const Domain& domain) {
+            std::vector<Elem> inOrder;
+            std::vector<int>  keys;
+            if constexpr (requires { domain.size(); }) {
+                inOrder.reserve(static_cast<std::size_t>(domain.size()));
+                keys.reserve(static_cast<std::size_t>(domain.size()));
+            }
+            for (const auto& v : domain) {
+                keys.push_back(detail::group_key<Dim>(v));
+                if constexpr (by_pointer)
+                    inOrder.push_back(&v);
+                else
+                    inOrder.push_back(v);
+            }
+            if (keys.empty())
+                return;
+            offsets_ = detail::KeyOffsets(keys);
+
+            // Scatter positions, then copy in key order (Elem may be a
+            // non-assignable view, so items_ is only ever appended to)
+            std::vector<std::size_t> order(inOrder.size());
+            std::vector<std::size_t> fill = offsets_.starts();
+            for (std::size_t n = 0; n < inOrder.size(); ++n)
+                order[fill[offsets_.slot(keys[n])]++] = n;
+            items_.reserve(inOrder.size());
+            for (std::size_t n : order)
+                items_.push_back(std::move(inOrder[n]));
+        }
+
+        // ------------------------------------------------------------------------
+        // Group access
+        // ------------------------------------------------------------------------
+        /**
+         * @brief Elements whose component Dim equals key (empty if none)
+         * @complexity O(1); O(log k) over k distinct keys if they are sparse
+         * @return std::span<const Elem> for copied elements; a view yielding
+         *         `const Value&` for pointer-stored records
+         */
+        auto operator[](int key) const {
+            auto [lo, hi] = block(key);
+            auto slice = std::span<const Elem>(items_).subspan(lo, hi - lo);
+            if constexpr (by_pointer)
+                return slice | std::views::transform([](Elem p) -> const auto& { return *p; });
+            else
+                return slice;
+        }
+
+        /// @brief Number of elements with key
+        /// @noexcept
+        std::size_t count(int key) const noexcept { auto [lo, hi] = block(key); return hi - lo; }
+
+        /// @brief Keys with at least one element, ascending
+        IndexList keys() const {
+            std::vector<int> out;
+            for (std::size_t s = 0; s < offsets_.slots(); ++s)
+                if (offsets_.count(s) > 0)
+                    out.push_back(offsets_.key(s));
+            return IndexList(std::move(out));
+        }
+
+        /// @brief Total number of grouped elements
+        /// @noexcept
+        std::size_t size()  const noexcept { return items_.size(); }
+        /// @brief Returns true if no elements were grouped
+        /// @noexcept
+        bool        empty() const noexcept { return items_.empty(); }
     };
 
+    /**
+     * @brief Index a domain by component Dim in one pass: `dsl::group_by<0>(D)`
+     * @details Works on any iterable domain: IndexList/RangeView (Dim 0),
+     *          Cartesian, Filtered, Relation, TupleList, Cached, and
+     *          IndexedVariableSet (grouped on Entry::index[Dim]).
+     */
+    template<std::size_t Dim, typename Domain>
+    auto group_by(const Domain& domain)
+    {
+        using Ref = decltype(*std::begin(domain));
+        return GroupIndex<Dim, detail::group_elem_t<Ref>>(domain);
+    }
+
     // ============================================================================
     // filter() IMPLEMENTATIONS (MEMBERS)
     // ============================================================================
@@ -888,14 +2906,20 @@ namespace dsl {
         return Filtered<IndexList, Combined>(*this, combined);
     }
 
-    // For Cartesian<Sets...>
+    // For Cartesian<Sets...>: prefix predicates are pushed down
     template<typename... Sets>
     template<typename... Preds>
     auto Cartesian<Sets...>::filter(const Preds&... preds) const
     {
-        using Combined = detail::PredAll<std::decay_t<Preds>...>;
-        Combined combined{ std::make_tuple(preds...) };
-        return Filtered<Cartesian<Sets...>, Combined>(*this, combined);
+        if constexpr (detail::wants_pushdown_v<sizeof...(Sets), std::decay_t<Preds>...>) {
+            return PushdownFiltered<Cartesian<Sets...>, std::decay_t<Preds>...>(
+                *this, std::make_tuple(preds...));
+        }
+        else {
+            using Combined = detail::PredAll<std::decay_t<Preds>...>;
+            Combined combined{ std::make_tuple(preds...) };
+            return Filtered<Cartesian<Sets...>, Combined>(*this, combined);
+        }
     }
 
     // For RangeView
@@ -907,6 +2931,45 @@ namespace dsl {
         return Filtered<RangeView, Combined>(*this, combined);
     }
 
+    // For IntervalSet
+    template<typename... Preds>
+    auto IntervalSet::filter(const Preds&... preds) const
+    {
+        using Combined = detail::PredAll<std::decay_t<Preds>...>;
+        Combined combined{ std::make_tuple(preds...) };
+        return Filtered<IntervalSet, Combined>(*this, combined);
+    }
+
+    // For Relation<N>
+    template<std::size_t N>
+    template<typename... Preds>
+    auto Relation<N>::filter(const Preds&... preds) const
+    {
+        using Combined = detail::PredAll<std::decay_t<Preds>...>;
+        Combined combined{ std::make_tuple(preds...) };
+        return Filtered<Relation<N>, Combined>(*this, combined);
+    }
+
+    // For TupleList<N>
+    template<std::size_t N>
+    template<typename... Preds>
+    auto TupleList<N>::filter(const Preds&... preds) const
+    {
+        using Combined = detail::PredAll<std::decay_t<Preds>...>;
+        Combined combined{ std::make_tuple(preds...) };
+        return Filtered<TupleList<N>, Combined>(*this, combined);
+    }
+
+    // For Cached<Domain> (copies share the store)
+    template<typename Domain>
+    template<typename... Preds>
+    auto Cached<Domain>::filter(const Preds&... preds) const
+    {
+        using Combined = detail::PredAll<std::decay_t<Preds>...>;
+        Combined combined{ std::make_tuple(preds...) };
+        return Filtered<Cached<Domain>, Combined>(*this, combined);
+    }
+
     // ============================================================================
     // PIPE ADAPTOR: dsl::filter(...) + operator|
     // ============================================================================
@@ -954,12 +3017,23 @@ namespace dsl {
         return Filtered<Product, PredAllT>(product, adaptor.pred_all);
     }
 
+    /// Pipe operator for Cartesian products: same as Cartesian::filter, so
+    /// prefix predicates (filter_on<D> or lower arity) are pushed down.
+    /// @brief Pipe operator for `Cartesian` with filter pushdown
+    template<typename... Sets, typename... Preds>
+    auto operator|(const Cartesian<Sets...>& product,
+                   const filter_adaptor<detail::PredAll<Preds...>>& adaptor)
+    {
+        return std::apply([&](const auto&... ps) { return product.filter(ps...); },
+                          adaptor.pred_all.preds);
+    }
+
     // ============================================================================
     // operator* OVERLOADS FOR CARTESIAN PRODUCTS
     // ============================================================================
     //
     // These create Cartesian<Sets...> objects from combinations of IndexList,
-    // RangeView, and existing Cartesian instances.
+    // RangeView, IntervalSet, and existing Cartesian instances.
     // ============================================================================
 
     /// Base case: Cartesian product of two IndexList objects.
@@ -1013,6 +3087,99 @@ namespace dsl {
         );
     }
 
+    /// @brief Cartesian product: `IntervalSet * IntervalSet`
+    inline auto operator*(const IntervalSet& A, const IntervalSet& B)
+    {
+        return Cartesian<IntervalSet, IntervalSet>(A, B);
+    }
+
+    /// @brief Cartesian product: `IntervalSet * IndexList`
+    inline auto operator*(const IntervalSet& A, const IndexList& B)
+    {
+        return Cartesian<IntervalSet, IndexList>(A, B);
+    }
+
+    /// @brief Cartesian product: `IndexList * IntervalSet`
+    inline auto operator*(const IndexList& A, const IntervalSet& B)
+    {
+        return Cartesian<IndexList, IntervalSet>(A, B);
+    }
+
+    /// @brief Cartesian product: `IntervalSet * RangeView`
+    inline auto operator*(const IntervalSet& A, const RangeView& B)
+    {
+        return Cartesian<IntervalSet, RangeView>(A, B);
+    }
+
+    /// @brief Cartesian product: `RangeView * IntervalSet`
+    inline auto operator*(const RangeView& A, const IntervalSet& B)
+    {
+        return Cartesian<RangeView, IntervalSet>(A, B);
+    }
+
+    /// @brief Extend existing Cartesian with `IntervalSet` on the right
+    template<typename... Sets>
+    inline auto operator*(const Cartesian<Sets...>& P, const IntervalSet& S) {
+        return std::apply(
+            [&](const Sets*... ptrs) {
+                return Cartesian<Sets..., IntervalSet>(*ptrs..., S);
+            },
+            P.raw_sets()
+        );
+    }
+
+    // Scalar Cached<D> factors (store_type == IndexList). The Cached object is
+    // held by address like any other factor; copies made elsewhere share its
+    // store, so the wrapped domain is still evaluated only once.
+
+    /// @brief Cartesian product: `Cached * IndexList`
+    template<typename D>
+        requires std::is_same_v<typename Cached<D>::store_type, IndexList>
+    inline auto operator*(const Cached<D>& A, const IndexList& B) {
+        return Cartesian<Cached<D>, IndexList>(A, B);
+    }
+
+    /// @brief Cartesian product: `IndexList * Cached`
+    template<typename D>
+        requires std::is_same_v<typename Cached<D>::store_type, IndexList>
+    inline auto operator*(const IndexList& A, const Cached<D>& B) {
+        return Cartesian<IndexList, Cached<D>>(A, B);
+    }
+
+    /// @brief Cartesian product: `Cached * RangeView`
+    template<typename D>
+        requires std::is_same_v<typename Cached<D>::store_type, IndexList>
+    inline auto operator*(const Cached<D>& A, const RangeView& B) {
+        return Cartesian<Cached<D>, RangeView>(A, B);
+    }
+
+    /// @brief Cartesian product: `RangeView * Cached`
+    template<typename D>
+        requires std::is_same_v<typename Cached<D>::store_type, IndexList>
+    inline auto operator*(const RangeView& A, const Cached<D>& B) {
+        return Cartesian<RangeView, Cached<D>>(A, B);
+    }
+
+    /// @brief Cartesian product: `Cached * Cached`
+    template<typename D1, typename D2>
+        requires std::is_same_v<typename Cached<D1>::store_type, IndexList>
+              && std::is_same_v<typename Cached<D2>::store_type, IndexList>
+    inline auto operator*(const Cached<D1>& A, const Cached<D2>& B) {
+        return Cartesian<Cached<D1>, Cached<D2>>(A, B);
+    }
+
+    /// @brief Extend existing Cartesian with a scalar `Cached` on the right
+    template<typename... Sets, typename D>
+        requires std::is_same_v<typename Cached<D>::store_type, IndexList>
+    inline auto operator*(const Cartesian<Sets...>& P, const Cached<D>& S) {
+        return std::apply(
+            [&](const Sets*... ptrs) {
+                return Cartesian<Sets..., Cached<D>>(*ptrs..., S);
+            },
+            P.raw_sets()
+        );
+    }
+
     // ============================================================================
     // PRINTING UTILITIES (operator<<)
     // ============================================================================
@@ -1088,6 +3255,89 @@ namespace dsl {
         return os;
     }
 
+    /**
+     * Stream insertion for IntervalSet.
+     *
+     * Format (example):
+     *   IntervalSet{{0,3},{5,6}}  ->  "intervals{[0, 3), [5, 6)}"
+     *
+     * Notes:
+     *   - Prints runs rather than elements, so huge horizons stay readable.
+     */
+    inline std::ostream& operator<<(std::ostream& os, const IntervalSet& S)
+    {
+        os << "intervals{";
+        for (std::size_t k = 0; k < S.runs().size(); ++k) {
+            os << "[" << S.runs()[k].first << ", " << S.runs()[k].second << ")";
+            if (k + 1 < S.runs().size()) os << ", ";
+        }
+        os << "}";
+        return os;
+    }
+
+    /**
+     * Stream insertion for Relation<N>.
+     *
+     * Format (example):
+     *   Relation<2>{{0,1},{1,2}}  ->  "relation{(0,1), (1,2)}"
+     *
+     * Notes:
+     *   - At most 10 tuples are printed, followed by "..." and the total count.
+     */
+    template<std::size_t N>
+    inline std::ostream& operator<<(std::ostream& os, const Relation<N>& R)
+    {
+        os << "relation{";
+        constexpr std::size_t limit = 10;
+        for (std::size_t k = 0; k < R.size() && k < limit; ++k) {
+            if (k > 0) os << ", ";
+            std::apply([&](auto const&... xs) {
+                os << "(";
+                std::size_t i = 0;
+                ((os << xs << (++i < N ? "," : "")), ...);
+                os << ")";
+                }, R[k]);
+        }
+        if (R.size() > limit) os << ", ... (" << R.size() << " tuples)";
+        os << "}";
+        return os;
+    }
+
+    /**
+     * Stream insertion for TupleList<N>.
+     *
+     * Format (example):
+     *   TupleList<2>{{1,0},{0,1}}  ->  "tuples{(1,0), (0,1)}"
+     *
+     * Notes:
+     *   - At most 10 tuples are printed, followed by "..." and the total count.
+     */
+    template<std::size_t N>
+    inline std::ostream& operator<<(std::ostream& os, const TupleList<N>& T)
+    {
+        os << "tuples{";
+        constexpr std::size_t limit = 10;
+        for (std::size_t k = 0; k < T.size() && k < limit; ++k) {
+            if (k > 0) os << ", ";
+            std::apply([&](auto const&... xs) {
+                os << "(";
+                std::size_t i = 0;
+                ((os << xs << (++i < N ? "," : "")), ...);
+                os << ")";
+                }, T[k]);
+        }
+        if (T.size() > limit) os << ", ... (" << T.size() << " tuples)";
+        os << "}";
+        return os;
+    }
+
+    /// Stream insertion for Cached<Domain>: prints the materialized store.
+    template<typename Domain>
+    inline std::ostream& operator<<(std::ostream& os, const Cached<Domain>& C)
+    {
+        return os << C.materialize();
+    }
+
     /**
      * Stream insertion for Cartesian<Sets...>.
      *
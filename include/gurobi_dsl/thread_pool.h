@@ -0,0 +1,348 @@
+#pragma once
+/*
+===============================================================================
+THREAD POOL  Work-stealing pool and rank partitioning of index domains
+===============================================================================
+
+OVERVIEW
+--------
+Shared parallel infrastructure for the DSL. WorkStealingPool executes batches
+of indexed tasks on a fixed set of threads; RankSlicer addresses any index
+domain by linear rank so it can be cut into contiguous, deterministic slices.
+Used by parallel.h (parallel_for / parallel_sum) and by
+ConstraintFactory::addIndexedParallel.
+
+KEY COMPONENTS
+--------------
+ WorkStealingPool  Fixed worker threads; per-participant deques, idle
+  participants steal from the back of others' queues
+ pool_detail::RankSlicer  Rank-addressed view of a domain for slicing
+ pool_detail::chunkCount()  Chunk count used for load balancing
+
+DESIGN PHILOSOPHY
+-----------------
+ Determinism: chunk boundaries depend only on domain size and pool size
+ Rank partitioning: random-access domains (Cartesian, IndexList) are sliced
+  through iterators, indexable ones (RangeView, IntervalSet) through
+  operator[]; other domains (e.g. Filtered) are enumerated once serially
+ The calling thread participates, so a pool of size 1 runs inline
+
+DEPENDENCIES
+------------
+ <thread>, <mutex>, <condition_variable>, <atomic>, <deque>, <exception>
+ <vector>, <functional>, <ranges>, <iterator>, <type_traits>, <algorithm>, <variant>
+
+PERFORMANCE NOTES
+-----------------
+ Domains are split into about 4 chunks per participant for load balance
+ Non-random-access domains are materialized into a vector of indices first
+
+THREAD SAFETY
+-------------
+ A pool executes one run() at a time; run() from inside a task executes inline
+ RankSlicer is read-only after construction; concurrent visit() is safe
+
+EXCEPTION SAFETY
+----------------
+ run(): the first exception thrown by a task is rethrown in the caller once
+  all participants have stopped; remaining tasks are skipped
+
+===============================================================================
+*/
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <functional>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <algorithm>
+#include <cstdint>
+#include <variant>
+
+namespace dsl {
+
+    // ============================================================================
+    // WORK-STEALING POOL
+    // ============================================================================
+    /**
+     * @class WorkStealingPool
+     * @brief Fixed-size pool executing batches of indexed tasks
+     *
+     * @details run(n, task) hands task ids 0..n-1 out in contiguous blocks,
+     *          one deque per participant (the workers plus the calling thread).
+     *          Each participant pops from the front of its own deque and, once
+     *          it is empty, steals from the back of the others. run() returns
+     *          after every participant has stopped.
+     *
+     * @example
+     *     dsl::WorkStealingPool pool(4);
+     *     pool.run(100, [&](std::size_t t) { process(t); });
+     */
+    class WorkStealingPool {
+    public:
+        /**
+         * @brief Pool with `threads` participants (threads - 1 workers + caller)
+         * @param threads Total parallelism; 0 means std::thread::hardware_concurrency()
+         */
+        explicit WorkStealingPool(unsigned threads = 0) {
+            if (threads == 0)
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            workers_.reserve(threads - 1);
+            for (unsigned w = 0; w + 1 < threads; ++w)
+                workers_.emplace_back([this, w] { workerLoop(w); });
+        }
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        ~WorkStealingPool() {
+            {
+                std::lock_guard lock(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto& t : workers_)
+                t.join();
+        }
+
+        /// @brief Number of participants (workers + calling thread)
+        /// @noexcept
+        [[nodiscard]] unsigned size() const noexcept {
+            return static_cast<unsigned>(workers_.size()) + 1;
+        }
+
+        /**
+         * @brief Execute task(0) .. task(n-1) and wait for completion
+         * @throws The first exception thrown by a task
+         * @note Tasks may run in any order and on any participant
+         */
+        void run(std::size_t n, const std::function<void(std::size_t)>& task) {
+            if (n == 0)
+                return;
+            if (workers_.empty() || n == 1 || inTask()) {
+                for (std::size_t t = 0; t < n; ++t)
+                    task(t);
+                return;
+            }
+
+            std::lock_guard runLock(runMutex_);
+            Job job(size(), n, task);
+            {
+                std::lock_guard lock(mutex_);
+                job_ = &job;
+                active_ = workers_.size();
+                ++generation_;
+            }
+            wake_.notify_all();
+
+            work(job, size() - 1);
+
+            {
+                std::unique_lock lock(mutex_);
+                done_.wait(lock, [&] { return active_ == 0; });
+                job_ = nullptr;
+            }
+            if (job.error)
+                std::rethrow_exception(job.error);
+        }
+
+        /// @brief Returns true on a thread currently executing a pool task
+        /// @noexcept
+        [[nodiscard]] static bool insideTask() noexcept { return inTask(); }
+
+        /// @brief Process-wide pool sized to the hardware concurrency
+        static WorkStealingPool& global() {
+            static WorkStealingPool pool;
+            return pool;
+        }
+
+    private:
+        struct Queue {
+            std::mutex              m;
+            std::deque<std::size_t> ids;
+        };
+
+        struct Job {
+            std::vector<Queue>                          queues;
+            const std::function<void(std::size_t)>&     task;
+            std::atomic<bool>                           cancelled{ false };
+            std::mutex                                  errorMutex;
+            std::exception_ptr                          error;
+
+            Job(unsigned participants, std::size_t n, const std::function<void(std::size_t)>& t)
+                : queues(participants)
+                , task(t)
+            {
+                for (unsigned p = 0; p < participants; ++p) {
+                    const std::size_t lo = n * p / participants;
+                    const std::size_t hi = n * (p + 1) / participants;
+                    for (std::size_t id = lo; id < hi; ++id)
+                        queues[p].ids.push_back(id);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers_;
+        std::mutex               runMutex_;     ///< Serializes run() calls
+        std::mutex               mutex_;        ///< Guards job_/active_/generation_/stop_
+        std::condition_variable  wake_;
+        std::condition_variable  done_;
+        Job*                     job_ = nullptr;
+        std::size_t              active_ = 0;
+        std::uint64_t            generation_ = 0;
+        bool                     stop_ = false;
+
+        static bool& inTask() {
+            thread_local bool flag = false;
+            return flag;
+        }
+
+        static bool popFront(Queue& q, std::size_t& id) {
+            std::lock_guard lock(q.m);
+            if (q.ids.empty()) return false;
+            id = q.ids.front();
+            q.ids.pop_front();
+            return true;
+        }
+
+        static bool popBack(Queue& q, std::size_t& id) {
+            std::lock_guard lock(q.m);
+            if (q.ids.empty()) return false;
+            id = q.ids.back();
+            q.ids.pop_back();
+            return true;
+        }
+
+        /// @brief Drain own queue, then steal until every queue is empty
+        static void work(Job& job, unsigned self) {
+            const auto P = static_cast<unsigned>(job.queues.size());
+            inTask() = true;
+            std::size_t id;
+            for (;;) {
+                bool found = popFront(job.queues[self], id);
+                for (unsigned k = 1; !found && k < P; ++k)
+                    found = popBack(job.queues[(self + k) % P], id);
+                if (!found)
+                    break;
+                if (job.cancelled.load(std::memory_order_relaxed))
+                    continue;
+                try {
+                    job.task(id);
+                }
+                catch (...) {
+                    std::lock_guard lock(job.errorMutex);
+                    if (!job.error)
+                        job.error = std::current_exception();
+                    job.cancelled = true;
+                }
+            }
+            inTask() = false;
+        }
+
+        void workerLoop(unsigned self) {
+            std::uint64_t seen = 0;
+            for (;;) {
+                Job* job;
+                {
+                    std::unique_lock lock(mutex_);
+                    wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                    if (stop_)
+                        return;
+                    seen = generation_;
+                    job = job_;
+                }
+                work(*job, self);
+                {
+                    std::lock_guard lock(mutex_);
+                    if (--active_ == 0)
+                        done_.notify_all();
+                }
+            }
+        }
+    };
+
+    // ============================================================================
+    // RANK PARTITIONING
+    // ============================================================================
+    namespace pool_detail {
+
+        /// @brief Domain addressable by position through size() and operator[]
+        template<typename D>
+        concept Indexable = requires(const D & d, std::size_t i) {
+            { d.size() } -> std::convertible_to<std::size_t>;
+            d[i];
+        };
+
+        /// @brief Domain that can be sliced by rank without copying it
+        template<typename D>
+        concept RankAddressable = std::ranges::random_access_range<const D> || Indexable<D>;
+
+        /// @brief Number of chunks for n elements on a pool (about 4 per participant)
+        inline std::size_t chunkCount(std::size_t n, const WorkStealingPool& pool) {
+            return std::min<std::size_t>(n, static_cast<std::size_t>(pool.size()) * 4);
+        }
+
+        /**
+         * @class RankSlicer
+         * @brief Rank-addressed, read-only view of an index domain
+         * @details Random-access ranges are walked with iterators (Cartesian's
+         *          ++ is an odometer step), indexable ones through operator[].
+         *          Other domains are enumerated once into a vector of indices
+         *          at construction. Elements keep the domain's iteration order.
+         */
+        template<typename Domain>
+        class RankSlicer {
+            using Idx = std::remove_cvref_t<decltype(*std::ranges::begin(std::declval<const Domain&>()))>;
+            static constexpr bool direct = RankAddressable<Domain>;
+
+        public:
+            /// @brief Slicer over `d` (must outlive the slicer when addressable directly)
+            explicit RankSlicer(const Domain& d)
+                : domain_(&d)
+            {
+                if constexpr (!direct) {
+                    for (const auto& idx : d)
+                        all_.push_back(idx);
+                }
+            }
+
+            /// @brief Number of elements
+            [[nodiscard]] std::size_t size() const {
+                if constexpr (direct)
+                    return static_cast<std::size_t>(domain_->size());
+                else
+                    return all_.size();
+            }
+
+            /// @brief Call visit(idx) for the elements with rank in [lo, hi)
+            template<typename Visit>
+            void visit(std::size_t lo, std::size_t hi, Visit&& visit) const {
+                if constexpr (std::ranges::random_access_range<const Domain>) {
+                    auto it = std::ranges::begin(*domain_) + static_cast<std::ptrdiff_t>(lo);
+                    for (std::size_t k = lo; k < hi; ++k, ++it)
+                        visit(*it);
+                }
+                else if constexpr (direct) {
+                    for (std::size_t k = lo; k < hi; ++k)
+                        visit((*domain_)[k]);
+                }
+                else {
+                    for (std::size_t k = lo; k < hi; ++k)
+                        visit(all_[k]);
+                }
+            }
+
+        private:
+            const Domain*                                            domain_;
+            std::conditional_t<direct, std::monostate, std::vector<Idx>> all_;
+        };
+
+    } // namespace pool_detail
+
+} // namespace dsl
@@ -0,0 +1,590 @@
+#pragma once
+/*
+===============================================================================
+TUPLE INDEX  Allocation-free integer-tuple lookup for indexed containers
+===============================================================================
+
+OVERVIEW
+--------
+Provides the hash index behind IndexedVariableSet and IndexedConstraintSet.
+Keys are fixed-arity integer tuples (the domain indices of each entry) stored
+packed in one flat int array; an open-addressing table with linear probing
+maps a tuple to its insertion position. Lookups hash the integers directly,
+so no std::string keys are formatted and no memory is allocated per query.
+
+KEY COMPONENTS
+--------------
+ TupleIndex  Packed key store + open-addressing position table
+ TupleIndex::densify()  Optional rank bitmap over the keys' bounding box
+ KeyedIterator  Random-access entry views over an item array + packed keys
+
+DESIGN PHILOSOPHY
+-----------------
+ Positions are implicit: the k-th inserted key has position k, matching
+  the entry order of the owning container (duplicates keep the first match)
+ Arity is fixed by the first inserted key; lookups with another arity miss
+ Heterogeneous lookup from variadic ints, std::array and std::span;
+  wider integral indices outside int range miss instead of being narrowed
+ The packed keys double as the owners' index storage: containers keep
+  only their items contiguously and iterate (item, key(pos)) pairs
+
+USAGE EXAMPLES
+--------------
+    dsl::TupleIndex idx;
+    idx.insert(std::array{ 1, 2 });       // position 0
+    idx.insert(std::array{ 3, 4 });       // position 1
+
+    std::size_t p = idx.find(3, 4);       // 1
+    bool miss = idx.find(5, 6) == dsl::TupleIndex::npos;
+
+DEPENDENCIES
+------------
+ <vector>, <array>, <span>, <cstdint>, <climits>, <stdexcept>, <type_traits>
+ <algorithm>, <bit> - Bounding box and popcount rank of the dense layout
+ <iterator>, <compare> - KeyedIterator
+
+PERFORMANCE NOTES
+-----------------
+ find(): O(1) expected, no allocation
+ insert(): amortized O(1); the table doubles at 50% load
+ Memory: size() * arity ints for keys + 4 bytes per table slot
+ Dense layout (densify()): find() is a bounds check, one bit probe and one
+  popcount; 1.5 bits per box cell (+ 4 bytes per key if not row-major ordered)
+
+THREAD SAFETY
+-------------
+ Concurrent const access (find, key) is safe
+ insert() requires external synchronization
+
+EXCEPTION SAFETY
+----------------
+ find() / contains() / key(): No-throw guarantee
+ insert(): Throws std::invalid_argument on arity mismatch,
+  std::length_error past 2^32 - 1 entries; std::bad_alloc on growth
+
+===============================================================================
+*/
+
+#include <vector>
+#include <array>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <stdexcept>
+#include <type_traits>
+#include <format>
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <compare>
+
+namespace dsl {
+
+    // ============================================================================
+    // TUPLE INDEX
+    // ============================================================================
+    /**
+     * @class TupleIndex
+     * @brief Open-addressing hash index over packed fixed-arity integer tuples
+     *
+     * @details Keys are appended to a flat `int` array (size() * arity()
+     *          elements). The slot table stores `position + 1` (0 == empty)
+     *          and is probed linearly from the tuple hash. Because keys are
+     *          compared against the packed store, a lookup touches only the
+     *          probed slots and the candidate key, never the heap allocator.
+     *
+     * @example
+     *     dsl::TupleIndex idx;
+     *     idx.insert(std::vector<int>{ 0, 1 });
+     *     if (const std::size_t p = idx.find(0, 1); p != dsl::TupleIndex::npos) { ... }
+     *
+     * @see IndexedVariableSet
+     * @see IndexedConstraintSet
+     */
+    class TupleIndex {
+    public:
+        /// @brief Returned by find() when the key is absent
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        /// @brief Default constructor; creates an empty index (arity unset)
+        TupleIndex() = default;
+
+        // ========================================================================
+        // INTROSPECTION
+        // ========================================================================
+
+        /// @brief Number of inserted keys (including duplicates)
+        /// @noexcept
+        [[nodiscard]] std::size_t size() const noexcept { return count; }
+
+        /// @brief Returns true if no key was inserted
+        /// @noexcept
+        [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+        /// @brief Key arity, or -1 while the index is empty
+        /// @noexcept
+        [[nodiscard]] int arity() const noexcept { return keyArity; }
+
+        /// @brief True while the dense rank-bitmap layout is active (see densify())
+        /// @noexcept
+        [[nodiscard]] bool dense() const noexcept { return denseMode; }
+
+        /**
+         * @brief Packed key at a position
+         * @param pos Insertion position (< size())
+         * @return View of arity() ints
+         * @noexcept
+         */
+        [[nodiscard]] std::span<const int> key(std::size_t pos) const noexcept {
+            const std::size_t a = static_cast<std::size_t>(keyArity < 0 ? 0 : keyArity);
+            return { keys.data() + pos * a, a };
+        }
+
+        // ========================================================================
+        // MODIFICATION
+        // ========================================================================
+
+        /**
+         * @brief Reserve room for n keys without rehashing
+         * @param n Expected number of keys
+         */
+        void reserve(std::size_t n) {
+            if (keyArity > 0) {
+                keys.reserve(n * static_cast<std::size_t>(keyArity));
+            }
+            if (denseMode) {
+                return;
+            }
+            std::size_t cap = 16;
+            while (cap < 2 * n) {
+                cap <<= 1;
+            }
+            if (cap > slots.size()) {
+                rehash(cap);
+            }
+        }
+
+        /**
+         * @brief Append a key at position size()
+         * @param k Key tuple
+         * @return true if the key was new, false if it duplicates an earlier key
+         *         (lookups keep resolving to the earlier position)
+         * @throws std::invalid_argument if k.size() differs from arity()
+         * @throws std::length_error if the index would exceed 2^32 - 1 keys
+         */
+        bool insert(std::span<const int> k) {
+            if (keyArity < 0) {
+                keyArity = static_cast<int>(k.size());
+            }
+            else if (k.size() != static_cast<std::size_t>(keyArity)) {
+                throw std::invalid_argument(
+                    std::format("TupleIndex::insert: expected {} indices, got {}",
+                        keyArity, k.size()));
+            }
+            if (count >= UINT32_MAX - 1) {
+                throw std::length_error("TupleIndex::insert: too many keys");
+            }
+            if (denseMode) {
+                dropDense();
+            }
+            if (2 * (count + 1) > slots.size()) {
+                rehash(slots.empty() ? 16 : slots.size() * 2);
+            }
+
+            const std::size_t pos = count;
+            keys.insert(keys.end(), k.begin(), k.end());
+            ++count;
+
+            const std::size_t mask = slots.size() - 1;
+            for (std::size_t s = hash(k) & mask; ; s = (s + 1) & mask) {
+                if (slots[s] == 0) {
+                    slots[s] = static_cast<std::uint32_t>(pos + 1);
+                    return true;
+                }
+                if (equals(slots[s] - 1, k)) {
+                    return false;
+                }
+            }
+        }
+
+        /// @brief insert() overload for std::vector keys
+        bool insert(const std::vector<int>& k) {
+            return insert(std::span<const int>(k));
+        }
+
+        /// @brief insert() overload for std::array keys
+        template<std::size_t N>
+        bool insert(const std::array<int, N>& k) {
+            return insert(std::span<const int>(k));
+        }
+
+        // ========================================================================
+        // LOOKUP
+        // ========================================================================
+
+        /**
+         * @brief Position of a key
+         * @param k Key tuple
+         * @return Insertion position of the first equal key, or npos
+         * @complexity O(1) expected
+         * @noexcept
+         */
+        [[nodiscard]] std::size_t find(std::span<const int> k) const noexcept {
+            if (count == 0 || k.size() != static_cast<std::size_t>(keyArity)) {
+                return npos;
+            }
+            if (denseMode) {
+                return findDense(k);
+            }
+            const std::size_t mask = slots.size() - 1;
+            for (std::size_t s = hash(k) & mask; slots[s] != 0; s = (s + 1) & mask) {
+                if (equals(slots[s] - 1, k)) {
+                    return slots[s] - 1;
+                }
+            }
+            return npos;
+        }
+
+        /// @brief find() overload for std::vector keys
+        [[nodiscard]] std::size_t find(const std::vector<int>& k) const noexcept {
+            return find(std::span<const int>(k));
+        }
+
+        /// @brief find() overload for std::array keys
+        template<std::size_t N>
+        [[nodiscard]] std::size_t find(const std::array<int, N>& k) const noexcept {
+            return find(std::span<const int>(k));
+        }
+
+        /**
+         * @brief True if an integral index value is representable as an int key
+         * @details Keys are stored as int. A long long / size_t index outside
+         *          [INT_MIN, INT_MAX] can never match, so lookups must reject
+         *          it rather than narrow it onto another key.
+         */
+        template<typename I>
+            requires std::is_integral_v<I>
+        [[nodiscard]] static constexpr bool fitsKey(I v) noexcept {
+            if constexpr (std::is_signed_v<I>) {
+                return static_cast<long long>(v) >= INT_MIN && static_cast<long long>(v) <= INT_MAX;
+            }
+            else {
+                return static_cast<unsigned long long>(v) <= static_cast<unsigned long long>(INT_MAX);
+            }
+        }
+
+        /**
+         * @brief find() from variadic integral indices (packed on the stack)
+         * @tparam I Integral index types
+         * @return npos if any index is outside int range (see fitsKey())
+         */
+        template<typename... I>
+            requires (std::is_integral_v<I> && ...)
+        [[nodiscard]] std::size_t find(I... idx) const noexcept {
+            if (!(fitsKey(idx) && ...)) {
+                return npos;
+            }
+            const std::array<int, sizeof...(I)> k{ static_cast<int>(idx)... };
+            return find(std::span<const int>(k));
+        }
+
+        /// @brief Returns true if the key is present
+        template<typename... Args>
+        [[nodiscard]] bool contains(const Args&... args) const noexcept {
+            return find(args...) != npos;
+        }
+
+        // ========================================================================
+        // DENSE LAYOUT
+        // ========================================================================
+
+        /// @brief densify() accepts bounding boxes of at most this many cells per key
+        static constexpr std::size_t DENSE_CELLS_PER_KEY = 32;
+
+        /**
+         * @brief Replace the hash table with a rank bitmap over the keys' bounding box
+         * @details Keys that fill a good fraction of their bounding box (a
+         *          filtered Cartesian product, 30%-dense assignments, ...) are
+         *          indexed by one bit per box cell. A 32-bit prefix popcount
+         *          per 64-bit word serves as the rank directory. find() then
+         *          computes the row-major cell of the key, probes one bit and
+         *          turns it into a position with a single popcount. No
+         *          hashing or key comparison is involved. A rank-to-position
+         *          array is kept only when insertion order differs from
+         *          row-major order.
+         *
+         *          The layout is used only if the box has at most
+         *          DENSE_CELLS_PER_KEY cells per key. The bitmap then costs
+         *          about as much as the hash table it replaces. A later
+         *          insert() reverts to the hash table.
+         * @return true if the dense layout is active
+         * @complexity O(size() * arity() + box cells / 64)
+         */
+        bool densify() {
+            if (denseMode) {
+                return true;
+            }
+            if (count == 0 || keyArity <= 0) {
+                return false;
+            }
+            const std::size_t a = static_cast<std::size_t>(keyArity);
+
+            std::vector<int> lo(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(a));
+            std::vector<int> hi = lo;
+            for (std::size_t pos = 1; pos < count; ++pos) {
+                const int* p = keys.data() + pos * a;
+                for (std::size_t d = 0; d < a; ++d) {
+                    lo[d] = std::min(lo[d], p[d]);
+                    hi[d] = std::max(hi[d], p[d]);
+                }
+            }
+
+            const std::uint64_t limit = static_cast<std::uint64_t>(DENSE_CELLS_PER_KEY) * count;
+            std::vector<std::uint64_t> ext(a), stride(a);
+            std::uint64_t cells = 1;
+            for (std::size_t d = 0; d < a; ++d) {
+                ext[d] = static_cast<std::uint64_t>(static_cast<long long>(hi[d]) - lo[d]) + 1;
+                if (cells > limit / ext[d]) {
+                    return false;                   // box too sparse (or too large)
+                }
+                cells *= ext[d];
+            }
+            for (std::size_t d = a; d-- > 0; ) {
+                stride[d] = d + 1 < a ? stride[d + 1] * ext[d + 1] : 1;
+            }
+
+            boxLo = std::move(lo);
+            boxExt = std::move(ext);
+            boxStride = std::move(stride);
+            bits.assign(static_cast<std::size_t>((cells + 63) / 64), 0);
+
+            // First occurrence of each key claims its cell (duplicates keep
+            // resolving to the earlier position, as in the hash layout)
+            std::vector<std::uint32_t> firstPos;
+            std::vector<std::uint64_t> firstCell;
+            firstPos.reserve(count);
+            firstCell.reserve(count);
+            for (std::size_t pos = 0; pos < count; ++pos) {
+                const std::uint64_t c = cellOf(key(pos));
+                std::uint64_t& word = bits[static_cast<std::size_t>(c >> 6)];
+                const std::uint64_t bit = std::uint64_t{ 1 } << (c & 63);
+                if ((word & bit) == 0) {
+                    word |= bit;
+                    firstPos.push_back(static_cast<std::uint32_t>(pos));
+                    firstCell.push_back(c);
+                }
+            }
+
+            rankBase.resize(bits.size());
+            std::uint32_t running = 0;
+            for (std::size_t w = 0; w < bits.size(); ++w) {
+                rankBase[w] = running;
+                running += static_cast<std::uint32_t>(std::popcount(bits[w]));
+            }
+
+            rankToPos.assign(firstPos.size(), 0);
+            bool identity = true;
+            for (std::size_t n = 0; n < firstPos.size(); ++n) {
+                const std::size_t r = rankOf(firstCell[n]);
+                rankToPos[r] = firstPos[n];
+                identity = identity && r == firstPos[n];
+            }
+            if (identity) {
+                rankToPos = {};
+            }
+
+            slots = {};
+            denseMode = true;
+            return true;
+        }
+
+    private:
+        std::vector<int>           keys;          ///< Packed keys, size() * arity()
+        std::vector<std::uint32_t> slots;         ///< position + 1, 0 == empty
+        std::size_t                count = 0;     ///< Number of inserted keys
+        int                        keyArity = -1; ///< Fixed by the first insert
+
+        bool                       denseMode = false; ///< Rank-bitmap layout active
+        std::vector<int>           boxLo;         ///< Dense: per-dimension minimum
+        std::vector<std::uint64_t> boxExt;        ///< Dense: per-dimension extent
+        std::vector<std::uint64_t> boxStride;     ///< Dense: row-major stride
+        std::vector<std::uint64_t> bits;          ///< Dense: one bit per box cell
+        std::vector<std::uint32_t> rankBase;      ///< Dense: set bits before each word
+        std::vector<std::uint32_t> rankToPos;     ///< Dense: rank -> position (empty == identity)
+
+        /// @brief Row-major cell of a key inside the box (key known to be inside)
+        std::uint64_t cellOf(std::span<const int> k) const noexcept {
+            std::uint64_t c = 0;
+            for (std::size_t d = 0; d < k.size(); ++d) {
+                c += static_cast<std::uint64_t>(static_cast<long long>(k[d]) - boxLo[d]) * boxStride[d];
+            }
+            return c;
+        }
+
+        /// @brief Number of set bits before cell c
+        std::size_t rankOf(std::uint64_t c) const noexcept {
+            const std::size_t w = static_cast<std::size_t>(c >> 6);
+            const std::uint64_t below = (std::uint64_t{ 1 } << (c & 63)) - 1;
+            return rankBase[w] + static_cast<std::size_t>(std::popcount(bits[w] & below));
+        }
+
+        /// @brief Dense-layout lookup: box check, bit probe, popcount rank
+        std::size_t findDense(std::span<const int> k) const noexcept {
+            std::uint64_t c = 0;
+            for (std::size_t d = 0; d < k.size(); ++d) {
+                const long long v = static_cast<long long>(k[d]) - boxLo[d];
+                if (v < 0 || static_cast<std::uint64_t>(v) >= boxExt[d]) {
+                    return npos;
+                }
+                c += static_cast<std::uint64_t>(v) * boxStride[d];
+            }
+            if (((bits[static_cast<std::size_t>(c >> 6)] >> (c & 63)) & 1) == 0) {
+                return npos;
+            }
+            const std::size_t r = rankOf(c);
+            return rankToPos.empty() ? r : rankToPos[r];
+        }
+
+        /// @brief Leave the dense layout and rebuild the hash table from the keys
+        void dropDense() {
+            denseMode = false;
+            boxLo = {};
+            boxExt = {};
+            boxStride = {};
+            bits = {};
+            rankBase = {};
+            rankToPos = {};
+
+            std::size_t cap = 16;
+            while (cap < 2 * (count + 1)) {
+                cap <<= 1;
+            }
+            slots.assign(cap, 0);
+            const std::size_t mask = cap - 1;
+            for (std::size_t pos = 0; pos < count; ++pos) {
+                const auto k = key(pos);
+                for (std::size_t s = hash(k) & mask; ; s = (s + 1) & mask) {
+                    if (slots[s] == 0) {
+                        slots[s] = static_cast<std::uint32_t>(pos + 1);
+                        break;
+                    }
+                    if (equals(slots[s] - 1, k)) {
+                        break;                      // duplicate: keep first
+                    }
+                }
+            }
+        }
+
+        /// @brief 64-bit multiplicative mix of the tuple elements
+        static std::size_t hash(std::span<const int> k) noexcept {
+            std::uint64_t h = 0xcbf29ce484222325ull;
+            for (int v : k) {
+                h = (h ^ static_cast<std::uint32_t>(v)) * 0x9e3779b97f4a7c15ull;
+                h ^= h >> 29;
+            }
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+        /// @brief Compare the packed key at pos with k (arity already checked)
+        bool equals(std::size_t pos, std::span<const int> k) const noexcept {
+            const int* p = keys.data() + pos * k.size();
+            for (std::size_t d = 0; d < k.size(); ++d) {
+                if (p[d] != k[d]) return false;
+            }
+            return true;
+        }
+
+        /// @brief Rebuild the slot table with a new power-of-two capacity
+        void rehash(std::size_t cap) {
+            std::vector<std::uint32_t> fresh(cap, 0);
+            const std::size_t mask = cap - 1;
+            for (std::size_t s = 0; s < slots.size(); ++s) {
+                if (slots[s] == 0) continue;
+                const std::size_t pos = slots[s] - 1;
+                std::size_t t = hash(key(pos)) & mask;
+                while (fresh[t] != 0) {
+                    t = (t + 1) & mask;
+                }
+                fresh[t] = slots[s];
+            }
+            slots.swap(fresh);
+        }
+    };
+
+
+    // ============================================================================
+    // KEYED ITERATOR
+    // ============================================================================
+    /**
+     * @class KeyedIterator
+     * @brief Random-access iterator yielding `Entry{ items[pos], keys.key(pos) }`
+     *
+     * @tparam Entry Aggregate of a reference to Item and a std::span<const int>
+     * @tparam Item  Element type of the contiguous item array (const for read-only)
+     *
+     * @details Entries are built on dereference and returned by value, so an
+     *          indexed container stores one contiguous item array plus the
+     *          TupleIndex key block instead of one heap-allocated index vector
+     *          per element.
+     *
+     * @note Models std::random_access_iterator with a proxy reference; bind
+     *       dereferenced entries by value or `const auto&`, not `auto&`.
+     */
+    template<typename Entry, typename Item>
+    class KeyedIterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Entry;
+        using reference = Entry;
+        using difference_type = std::ptrdiff_t;
+
+        KeyedIterator() = default;
+
+        KeyedIterator(Item* items, const TupleIndex* keys, std::size_t pos) noexcept
+            : items_(items), keys_(keys), pos_(static_cast<difference_type>(pos)) {}
+
+        reference operator*() const noexcept {
+            return Entry{ items_[pos_], keys_->key(static_cast<std::size_t>(pos_)) };
+        }
+
+        /// @brief `it->field` support: holds the entry built on dereference
+        struct ArrowProxy {
+            Entry entry;
+            const Entry* operator->() const noexcept { return &entry; }
+        };
+
+        ArrowProxy operator->() const noexcept { return { **this }; }
+
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        KeyedIterator& operator++() noexcept { ++pos_; return *this; }
+        KeyedIterator operator++(int) noexcept { auto t = *this; ++pos_; return t; }
+        KeyedIterator& operator--() noexcept { --pos_; return *this; }
+        KeyedIterator operator--(int) noexcept { auto t = *this; --pos_; return t; }
+
+        KeyedIterator& operator+=(difference_type n) noexcept { pos_ += n; return *this; }
+        KeyedIterator& operator-=(difference_type n) noexcept { pos_ -= n; return *this; }
+
+        friend KeyedIterator operator+(KeyedIterator it, difference_type n) noexcept { return it += n; }
+        friend KeyedIterator operator+(difference_type n, KeyedIterator it) noexcept { return it += n; }
+        friend KeyedIterator operator-(KeyedIterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const KeyedIterator& a, const KeyedIterator& b) noexcept {
+            return a.pos_ - b.pos_;
+        }
+
+        friend bool operator==(const KeyedIterator& a, const KeyedIterator& b) noexcept {
+            return a.pos_ == b.pos_;
+        }
+        friend auto operator<=>(const KeyedIterator& a, const KeyedIterator& b) noexcept {
+            return a.pos_ <=> b.pos_;
+        }
+
+    private:
+        Item*             items_ = nullptr;
+        const TupleIndex* keys_ = nullptr;
+        difference_type   pos_ = 0;
+    };
+
+} // namespace dsl
@@ -14,8 +14,11 @@ KEY COMPONENTS
 --------------
  VariableGroup  Dense N-dimensional container of GRBVar (scalars, vectors, matrices, tensors)
  IndexedVariableSet  Variables indexed by arbitrary domains (Cartesian products, filtered sets)
+ VarArray<N> / SparseVars<N>  Statically ranked counterparts (std::array<int, N> indices)
  VariableFactory  Unified backend for creating rectangular and domain-based variables
  VariableTable  Enum-keyed registry for organizing variable collections
+  (locate() maps a Gurobi column index back to key + index tuple)
+ Attribute Queries  getAttr() reads a double attribute for a whole container
  Solution Extraction  value(), values() for retrieving optimization results
  Variable Modification  fix(), unfix(), setStart() for bounds and warm starts
 
@@ -47,6 +50,7 @@ USAGE EXAMPLES
     // Solution extraction (after optimization)
     double val = dsl::value(x);              // Single variable
     auto vals = dsl::values(X);              // All variables in group
+    auto rc   = dsl::getAttr(X, GRB_DoubleAttr_RC);  // One array query
 
     // Variable modification
     dsl::fix(x, 1.0);                        // Fix to specific value
@@ -67,13 +71,27 @@ DEPENDENCIES
  "gurobi_c++.h"  Gurobi C++ API
  "naming.h"  Variable naming utilities
  "enum_utils.h"  Enum introspection for VariableTable
+ "tuple_index.h"  Integer-tuple hash index for IndexedVariableSet
+ "flat_traversal.h"  forEachVar / forEachFlat shared by all containers
 
 PERFORMANCE NOTES
 -----------------
- VariableGroup: O(dims) tree traversal for indexed access
- IndexedVariableSet: O(1) average lookup via hash map
- Memory: Tree nodes for VariableGroup; flat vector + hash map for IndexedVariableSet
+ Creation: add()/addIndexed() use chunked GRBModel::addVars calls
+  (VariableFactory::setBatchSize() controls the chunk size)
+ VariableGroup: O(dims) stride arithmetic for indexed access; O(1) count()
+ IndexedVariableSet: O(1) average lookup via integer-tuple hash (no allocation)
+ IndexedVariableSet from addIndexed over a dense box subset: bit probe + popcount rank, no hashing
+ Memory: One contiguous row-major buffer for VariableGroup; structure of
+  arrays for IndexedVariableSet (contiguous GRBVar array + the TupleIndex's
+  packed size() * arity int block, no per-entry index allocation)
+ fixAll / setStartAll / setLB / setUB: array attribute setters (2, 1, 1, 1 calls)
  forEach: Linear in number of variables, no allocation per iteration
+ VariableTable::locate(): binary search over per-container column runs,
+  O(log #runs) (one run per container created in one factory call)
+ forEachVar / forEachFlat: plain loop over the contiguous variable array
+  (no index tuple at all); used by sum(), CallbackSolution::getValues()
+ VarArray<N> / SparseVars<N>: arity checked at compile time; forEach passes
+  a stack std::array<int, N>, at() unrolls the offset over N fixed strides
 
 THREAD SAFETY
 -------------
@@ -87,7 +105,7 @@ EXCEPTION SAFETY
  at() / operator(): Throws std::out_of_range or std::runtime_error on invalid access
  try_get(): No-throw guarantee (returns nullptr on missing index)
  forEach: Propagates exceptions from user-provided callback
- value() / values(): Propagates GRBException if model not optimized
+ value() / values() / getAttr(): Propagates GRBException if model not optimized
  fix() / unfix() / setStart(): Propagates GRBException on invalid operations
 
 ===============================================================================
@@ -102,10 +120,20 @@ EXCEPTION SAFETY
 #include <unordered_map>
 #include <sstream>
 #include <variant>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <climits>
+#include <span>
+#include <ranges>
+#include <utility>
+#include <optional>
 
 #include "gurobi_c++.h"
 #include "naming.h"
 #include "enum_utils.h"
+#include "tuple_index.h"
+#include "flat_traversal.h"
 
 namespace dsl {
 
@@ -124,9 +152,10 @@ class VariableFactory; // forward declaration
  *           2D matrix (dims == 2)
  *           N-dimensional tensor (dims == N)
  *
- *          Internal representation uses a tree of Node objects:
- *           Leaf nodes (children.empty()): contain a GRBVar
- *           Container nodes: have children.size() sub-nodes
+ *          Internal representation is a single contiguous row-major buffer
+ *          of GRBVar plus shape and stride arrays (mdspan-style):
+ *           Element (i0, i1, ..., iN-1) lives at sum(ik * stride[k])
+ *           A scalar group holds exactly one element and an empty shape
  *
  * @note Supports both variadic at(i,j,k,...) and vector-based at(vec) access.
  *
@@ -140,7 +169,7 @@ class VariableFactory; // forward declaration
  * @see VariableFactory
  * @see IndexedVariableSet
  */
-class VariableGroup {
+class VariableGroup : public FlatTraversal<VariableGroup> {
     public:
         // ========================================================================
         // NODE STRUCTURE
@@ -148,10 +177,12 @@ class VariableGroup {
 
         /**
          * @struct Node
-         * @brief Internal tree node for N-dimensional variable storage
+         * @brief Tree description of an N-dimensional group
          *
-         * @details Leaf nodes store a GRBVar in `scalar`; container nodes
-         *          have non-empty `children` vector.
+         * @details Kept for source compatibility with code that builds groups
+         *          from a tree: VariableGroup(Node&&, int) flattens it into the
+         *          contiguous layout. Leaf nodes store a GRBVar in `scalar`;
+         *          container nodes have non-empty `children` vector.
          */
         struct Node {
             GRBVar scalar;                ///< Stored variable (valid if children.empty())
@@ -171,8 +202,11 @@ class VariableGroup {
         };
 
     private:
-        Node root;      ///< Root node of the variable tree
-        int  dims = 0;  ///< Number of dimensions (0 == scalar)
+        std::vector<GRBVar>      data;      ///< Row-major element buffer
+        std::vector<std::size_t> extents;   ///< Size of each dimension
+        std::vector<std::size_t> strides;   ///< Row-major stride of each dimension
+        int dims = 0;                       ///< Number of dimensions (0 == scalar)
+        GRBModel* owner = nullptr;          ///< Model holding the variables (if known)
 
     public:
         // ========================================================================
@@ -180,7 +214,7 @@ class VariableGroup {
         // ========================================================================
 
         /// @brief Default constructor; creates an empty VariableGroup
-        VariableGroup() = default;
+        VariableGroup() : data(1) {}
 
         /**
          * @brief Construct scalar VariableGroup from GRBVar (copy)
@@ -188,7 +222,7 @@ class VariableGroup {
          * @post dimension() == 0, isScalar() == true
          */
         explicit VariableGroup(const GRBVar& v)
-            : root(Node(v)), dims(0) {
+            : data(1, v), dims(0) {
         }
 
         /**
@@ -197,21 +231,62 @@ class VariableGroup {
          * @post dimension() == 0, isScalar() == true
          */
         explicit VariableGroup(GRBVar&& v)
-            : root(Node(std::move(v))), dims(0) {
+            : dims(0) {
+            data.push_back(std::move(v));
         }
 
         /**
-         * @brief Construct from pre-built node tree
+         * @brief Construct from a row-major buffer and its shape
+         * @param vars Variables in row-major order (moved)
+         * @param shp Size of each dimension (empty for a scalar)
+         * @throws std::invalid_argument if vars.size() != product of shp
+         *
+         * @example
+         *     std::vector<GRBVar> flat = ...;           // 6 variables
+         *     VariableGroup X(std::move(flat), {2, 3}); // X(1, 2) == flat[5]
+         */
+        VariableGroup(std::vector<GRBVar>&& vars, std::vector<std::size_t> shp)
+            : data(std::move(vars)),
+              extents(std::move(shp)),
+              dims(static_cast<int>(extents.size())) {
+            computeStrides();
+            const std::size_t expected = dims == 0 ? 1 : total();
+            if (data.size() != expected) {
+                throw std::invalid_argument(
+                    std::format("VariableGroup: {} variables do not match shape of {} elements",
+                        data.size(), expected));
+            }
+        }
+
+        /**
+         * @brief Construct from a node tree (flattened into row-major storage)
          * @param r Root node (moved)
          * @param d Number of dimensions
-         * @throws std::invalid_argument if d < 0
+         * @throws std::invalid_argument if d < 0 or the tree is not rectangular
          */
         VariableGroup(Node&& r, int d)
-            : root(std::move(r)), dims(d) {
+            : dims(d) {
             if (d < 0) {
                 throw std::invalid_argument(
                     std::format("VariableGroup: negative dimension {}", d));
             }
+
+            const Node* n = &r;
+            for (int k = 0; k < d; ++k) {
+                extents.push_back(n->children.size());
+                if (!n->children.empty()) {
+                    n = &n->children[0];
+                }
+            }
+            computeStrides();
+
+            if (d == 0) {
+                data.push_back(std::move(r.scalar));
+            }
+            else {
+                data.reserve(total());
+                flattenRec(r, 0);
+            }
         }
 
         // ========================================================================
@@ -240,16 +315,7 @@ class VariableGroup {
          *     auto shp = X.shape();  // {3, 4, 5}
          */
         [[nodiscard]] std::vector<std::size_t> shape() const {
-            std::vector<std::size_t> shp;
-            shp.reserve(dims);
-
-            const Node* n = &root;
-            for (int d = 0; d < dims; ++d) {
-                if (n->children.empty()) break;
-                shp.push_back(n->children.size());
-                n = &n->children[0];
-            }
-            return shp;
+            return extents;
         }
 
         /**
@@ -257,7 +323,7 @@ class VariableGroup {
          * @param dim Dimension index (0-based)
          * @return Number of elements in that dimension
          * @throws std::out_of_range if dim < 0 or dim >= dimension()
-         * @complexity O(dim)
+         * @complexity Constant time
          */
         [[nodiscard]] std::size_t size(int dim) const {
             if (dim < 0 || dim >= dims) {
@@ -265,18 +331,13 @@ class VariableGroup {
                     std::format("VariableGroup::size: dim {} out of range [0, {})",
                         dim, dims));
             }
-
-            const Node* n = &root;
-            for (int d = 0; d < dim; ++d) {
-                n = &n->children[0];
-            }
-            return n->children.size();
+            return extents[static_cast<std::size_t>(dim)];
         }
 
         /**
          * @brief Returns the total number of variables in the group
          * @return Total count of variables (product of all dimension sizes)
-         * @complexity O(n) where n = total number of variables
+         * @complexity Constant time
          *
          * @note For scalars, returns 1.
          * @note Useful for validation in fixAll/setStartAll.
@@ -285,12 +346,49 @@ class VariableGroup {
          *     auto X = VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 3, 4);
          *     std::size_t n = X.count();  // 12
          */
-        [[nodiscard]] std::size_t count() const {
-            std::size_t total = 0;
-            forEach([&](const GRBVar&, const std::vector<int>&) { ++total; });
-            return total;
+        [[nodiscard]] std::size_t count() const noexcept {
+            return data.size();
         }
 
+        /**
+         * @brief Contiguous row-major view of all variables
+         * @return Span over the element buffer (forEach order)
+         * @noexcept
+         *
+         * @note Element (i, j, k) is flat()[i*stride(0) + j*stride(1) + k].
+         */
+        [[nodiscard]] std::span<GRBVar> flat() noexcept { return data; }
+
+        /// @brief Const version of flat()
+        [[nodiscard]] std::span<const GRBVar> flat() const noexcept { return data; }
+
+        /**
+         * @brief Returns the row-major stride of a dimension
+         * @param dim Dimension index (0-based)
+         * @throws std::out_of_range if dim < 0 or dim >= dimension()
+         */
+        [[nodiscard]] std::size_t stride(int dim) const {
+            if (dim < 0 || dim >= dims) {
+                throw std::out_of_range(
+                    std::format("VariableGroup::stride: dim {} out of range [0, {})",
+                        dim, dims));
+            }
+            return strides[static_cast<std::size_t>(dim)];
+        }
+
+        /**
+         * @brief Model the variables belong to
+         * @return Owning model, or nullptr if the group was built by hand
+         * @noexcept
+         *
+         * @note Set by VariableFactory. When known, getAttr() and values()
+         *       read the whole group with one array attribute query.
+         */
+        [[nodiscard]] GRBModel* model() const noexcept { return owner; }
+
+        /// @brief Record the model holding the variables (enables bulk queries)
+        void setModel(GRBModel& m) noexcept { owner = &m; }
+
         // ========================================================================
         // ACCESS (VARIADIC INDICES)
         // ========================================================================
@@ -302,7 +400,7 @@ class VariableGroup {
          * @return Mutable reference to the GRBVar at the specified position
          * @throws std::runtime_error if number of indices != dimension()
          * @throws std::out_of_range if any index is out of bounds
-         * @complexity O(dims)
+         * @complexity O(dims) arithmetic, no pointer chasing
          *
          * @example
          *     auto X = VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 10, 20);
@@ -319,7 +417,11 @@ class VariableGroup {
                     std::format("VariableGroup::at: expected {} indices, got {}",
                         dims, N));
             }
-            return atRec(root, idx...);
+
+            std::size_t offset = 0;
+            std::size_t d = 0;
+            ((offset += checkedIndex(static_cast<long long>(idx), d) * strides[d], ++d), ...);
+            return data[offset];
         }
 
         /// @brief Const version of at()
@@ -348,7 +450,7 @@ class VariableGroup {
                     std::format("VariableGroup::scalar: group is {}-dimensional",
                         dims));
             }
-            return root.scalar;
+            return data.front();
         }
 
         /// @brief Const version of scalar()
@@ -358,7 +460,7 @@ class VariableGroup {
                     std::format("VariableGroup::scalar: group is {}-dimensional",
                         dims));
             }
-            return root.scalar;
+            return data.front();
         }
 
         // ========================================================================
@@ -388,7 +490,12 @@ class VariableGroup {
                     std::format("VariableGroup::at(vec): expected {} indices, got {}",
                         dims, idxVec.size()));
             }
-            return atVecRec(root, idxVec, 0);
+
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < idxVec.size(); ++d) {
+                offset += checkedIndex(idxVec[d], d) * strides[d];
+            }
+            return data[offset];
         }
 
         /// @brief Const version of at(vector)
@@ -404,7 +511,7 @@ class VariableGroup {
          * @brief Iterate over all GRBVar entries with their indices
          * @tparam Fn Callable with signature (GRBVar&, const std::vector<int>&)
          * @param fn Function to call for each variable
-         * @complexity O(total number of variables)
+         * @complexity O(total number of variables); linear scan of the buffer
          *
          * @example
          *     X.forEach([](GRBVar& v, const std::vector<int>& idx) {
@@ -415,17 +522,13 @@ class VariableGroup {
          */
         template<typename Fn>
         void forEach(Fn&& fn) {
-            std::vector<int> idx;
-            idx.reserve(dims);
-            forEachRec(root, idx, fn);
+            forEachImpl(*this, fn);
         }
 
         /// @brief Const version of forEach()
         template<typename Fn>
         void forEach(Fn&& fn) const {
-            std::vector<int> idx;
-            idx.reserve(dims);
-            forEachRecConst(root, idx, fn);
+            forEachImpl(*this, fn);
         }
 
     private:
@@ -433,88 +536,70 @@ class VariableGroup {
         // PRIVATE HELPERS
         // ========================================================================
 
-        /// @brief Leaf case for variadic atRec
-        GRBVar& atRec(Node& n) {
-            return n.scalar;
-        }
-
-        /// @brief Recursive descent for variadic indices
-        template<typename First, typename... Rest>
-        GRBVar& atRec(Node& n, First i, Rest... rest) {
-            if (i < 0) {
-                throw std::out_of_range(
-                    std::format("VariableGroup::atRec: negative index {}", i));
-            }
-
-            std::size_t idx = static_cast<std::size_t>(i);
-            if (idx >= n.children.size()) {
-                throw std::out_of_range(
-                    std::format("VariableGroup::atRec: index {} out of range [0, {})",
-                        i, n.children.size()));
+        /// @brief Product of all extents
+        [[nodiscard]] std::size_t total() const noexcept {
+            std::size_t n = 1;
+            for (std::size_t e : extents) {
+                n *= e;
             }
-
-            return atRec(n.children[idx], rest...);
+            return n;
         }
 
-        /// @brief Recursive descent for vector-based indices
-        GRBVar& atVecRec(Node& n, const std::vector<int>& idx, std::size_t d) {
-            if (d == idx.size()) {
-                return n.scalar;
+        /// @brief Recompute row-major strides from extents
+        void computeStrides() {
+            strides.assign(extents.size(), 1);
+            for (std::size_t d = extents.size(); d-- > 1; ) {
+                strides[d - 1] = strides[d] * extents[d];
             }
+        }
 
-            int i = idx[d];
+        /// @brief Bounds-check one index against its dimension
+        [[nodiscard]] std::size_t checkedIndex(long long i, std::size_t d) const {
             if (i < 0) {
                 throw std::out_of_range(
-                    std::format("VariableGroup::atVecRec: negative index {} at dim {}",
+                    std::format("VariableGroup::at: negative index {} at dim {}",
                         i, d));
             }
-
-            std::size_t pos = static_cast<std::size_t>(i);
-            if (pos >= n.children.size()) {
+            if (static_cast<unsigned long long>(i) >= extents[d]) {
                 throw std::out_of_range(
-                    std::format("VariableGroup::atVecRec: index {} out of range [0, {}) at dim {}",
-                        i, n.children.size(), d));
+                    std::format("VariableGroup::at: index {} out of range [0, {}) at dim {}",
+                        i, extents[d], d));
             }
-
-            return atVecRec(n.children[pos], idx, d + 1);
+            return static_cast<std::size_t>(i);
         }
 
-        /// @brief Recursive forEach implementation (mutable)
-        template<typename Fn>
-        static void forEachRec(Node& n,
-            std::vector<int>& idx,
-            Fn& fn) {
-            if (n.children.empty()) {
-                fn(n.scalar, idx);
-                return;
+        /// @brief Append the leaves of a node tree in row-major order
+        void flattenRec(Node& n, std::size_t d) {
+            if (n.children.size() != extents[d]) {
+                throw std::invalid_argument(
+                    std::format("VariableGroup: ragged node tree at dim {} ({} vs {})",
+                        d, n.children.size(), extents[d]));
             }
-
-            for (std::size_t i = 0; i < n.children.size(); ++i) {
-                idx.push_back(static_cast<int>(i));
-                forEachRec(n.children[i], idx, fn);
-                idx.pop_back();
+            for (auto& child : n.children) {
+                if (d + 1 == extents.size()) {
+                    data.push_back(std::move(child.scalar));
+                }
+                else {
+                    flattenRec(child, d + 1);
+                }
             }
         }
 
-        /// @brief Recursive forEach implementation (const)
-        template<typename Fn>
-        static void forEachRecConst(const Node& n,
-            std::vector<int>& idx,
-            Fn& fn)
-        {
-            if (n.children.empty()) {
-                fn(n.scalar, idx);
-                return;
-            }
-
-            for (std::size_t i = 0; i < n.children.size(); ++i) {
-                idx.push_back(static_cast<int>(i));
-                forEachRecConst(n.children[i], idx, fn);
-                idx.pop_back();
+        /// @brief Linear scan with an odometer-style index (mutable or const)
+        template<typename Self, typename Fn>
+        static void forEachImpl(Self& self, Fn& fn) {
+            std::vector<int> idx(static_cast<std::size_t>(self.dims), 0);
+            for (std::size_t k = 0; k < self.data.size(); ++k) {
+                fn(self.data[k], idx);
+                for (std::size_t d = idx.size(); d-- > 0; ) {
+                    if (static_cast<std::size_t>(++idx[d]) < self.extents[d]) break;
+                    idx[d] = 0;
+                }
             }
         }
 
         friend class VariableFactory;
+        template<std::size_t> friend class VarArray;
     };
 
 
@@ -525,8 +610,14 @@ class VariableGroup {
      * @class IndexedVariableSet
      * @brief Variables indexed by arbitrary domains (Cartesian products, filtered sets)
      *
-     * @details Stores a flat list of entries where each entry contains a GRBVar
-     *          and its associated index vector. Provides O(1) lookup via hash map.
+     * @details Stores entries as a structure of arrays: the GRBVars in one
+     *          contiguous array and their index tuples packed in the key block
+     *          of an integer-tuple hash index (TupleIndex), which also gives
+     *          O(1) lookup. Iteration yields lightweight Entry views
+     *          (GRBVar&, std::span<const int>). Sets built by
+     *          VariableFactory::addIndexed whose keys fill enough of their
+     *          bounding box (e.g. filtered Cartesian products) use the
+     *          TupleIndex rank bitmap instead, so at() does no hashing.
      *
      *          The domain can be any iterable whose elements are either:
      *           An int (1-dimensional)
@@ -553,7 +644,7 @@ class VariableGroup {
      * @see VariableFactory::addIndexed
      * @see VariableGroup
      */
-    class IndexedVariableSet {
+    class IndexedVariableSet : public FlatTraversal<IndexedVariableSet> {
     public:
         // ========================================================================
         // ENTRY STRUCTURE
@@ -561,19 +652,29 @@ class VariableGroup {
 
         /**
          * @struct Entry
-         * @brief Stores a GRBVar with its associated index vector
+         * @brief View of one variable and its index tuple
+         *
+         * @note Built on dereference; var refers into the variable array and
+         *       index into the packed keys. Valid until the set is modified.
          */
         struct Entry {
-            GRBVar var;               ///< The decision variable
-            std::vector<int> index;   ///< Index tuple for this variable
+            GRBVar& var;                  ///< The decision variable
+            std::span<const int> index;   ///< Index tuple for this variable
+        };
+
+        /// @brief Read-only Entry view (const iteration)
+        struct ConstEntry {
+            const GRBVar& var;            ///< The decision variable
+            std::span<const int> index;   ///< Index tuple for this variable
         };
 
     private:
-        std::vector<Entry> entries;                        ///< Flat list of all entries
-        std::unordered_map<std::string, std::size_t> indexMap;  ///< Hash map for O(1) lookup
+        std::vector<GRBVar> vars;     ///< Variables in entry order, contiguous
+        TupleIndex lookup;            ///< Packed index tuples + hash index (entry positions)
+        GRBModel* owner = nullptr;    ///< Model holding the variables (if known)
 
-        /// @brief Create lookup key from index vector
-        static std::string makeKeyFromVector(const std::vector<int>& idx) {
+        /// @brief Format an index tuple for error messages
+        static std::string makeKeyFromVector(std::span<const int> idx) {
             std::ostringstream oss;
             for (std::size_t k = 0; k < idx.size(); ++k) {
                 if (k > 0) {
@@ -584,7 +685,7 @@ class VariableGroup {
             return oss.str();
         }
 
-        /// @brief Create lookup key from variadic indices
+        /// @brief Format variadic indices for error messages
         template<typename... I>
         static std::string makeKey(I... idx) {
             static_assert((std::is_integral_v<I> && ...),
@@ -596,12 +697,15 @@ class VariableGroup {
             return oss.str();
         }
 
-        /// @brief Add an entry to the set
-        void addEntry(GRBVar&& v, std::vector<int>&& idx) {
-            std::size_t pos = entries.size();
-            std::string key = makeKeyFromVector(idx);
-            indexMap.emplace(std::move(key), pos);
-            entries.push_back(Entry{ std::move(v), std::move(idx) });
+        /// @brief Call fn(var, idx) per entry; idx is one reused scratch vector
+        template<typename Self, typename Fn>
+        static void forEachImpl(Self& self, Fn& fn) {
+            std::vector<int> idx;
+            for (std::size_t k = 0; k < self.vars.size(); ++k) {
+                const auto key = self.lookup.key(k);
+                idx.assign(key.begin(), key.end());
+                fn(self.vars[k], idx);
+            }
         }
 
     public:
@@ -618,38 +722,68 @@ class VariableGroup {
 
         /// @brief Returns the number of variables in the set
         /// @noexcept
-        [[nodiscard]] std::size_t size() const noexcept { return entries.size(); }
+        [[nodiscard]] std::size_t size() const noexcept { return vars.size(); }
 
         /// @brief Returns true if the set is empty
         /// @noexcept
-        [[nodiscard]] bool empty() const noexcept { return entries.empty(); }
+        [[nodiscard]] bool empty() const noexcept { return vars.empty(); }
+
+        /**
+         * @brief Model the variables belong to
+         * @return Owning model, or nullptr if unknown
+         * @noexcept
+         *
+         * @note Set by VariableFactory::addIndexed; enables bulk getAttr().
+         */
+        [[nodiscard]] GRBModel* model() const noexcept { return owner; }
+
+        /// @brief Record the model holding the variables (enables bulk queries)
+        void setModel(GRBModel& m) noexcept { owner = &m; }
+
+        /// @brief True if lookups use the dense rank bitmap (see TupleIndex::densify())
+        /// @noexcept
+        [[nodiscard]] bool denseLookup() const noexcept { return lookup.dense(); }
+
+        /**
+         * @brief Contiguous view of all variables in storage order
+         * @return Span over the variable array (flat()[k] is all()[k].var)
+         * @noexcept
+         *
+         * @note This is the entry storage itself, so bulk attribute calls
+         *       need no gather step.
+         */
+        [[nodiscard]] std::span<const GRBVar> flat() const noexcept { return vars; }
+
+        /// @brief Mutable version of flat()
+        [[nodiscard]] std::span<GRBVar> flat() noexcept { return vars; }
 
         // ========================================================================
         // ITERATION
         // ========================================================================
 
-        using iterator = std::vector<Entry>::iterator;
-        using const_iterator = std::vector<Entry>::const_iterator;
+        /// @note Iterators yield Entry / ConstEntry by value (bind with `const auto&`)
+        using iterator = KeyedIterator<Entry, GRBVar>;
+        using const_iterator = KeyedIterator<ConstEntry, const GRBVar>;
 
         /// @brief Begin iterator
         /// @noexcept
-        iterator begin() noexcept { return entries.begin(); }
+        iterator begin() noexcept { return { vars.data(), &lookup, 0 }; }
 
         /// @brief End iterator
         /// @noexcept
-        iterator end() noexcept { return entries.end(); }
+        iterator end() noexcept { return { vars.data(), &lookup, vars.size() }; }
 
         /// @brief Begin iterator (const)
         /// @noexcept
-        const_iterator begin() const noexcept { return entries.begin(); }
+        const_iterator begin() const noexcept { return { vars.data(), &lookup, 0 }; }
 
         /// @brief End iterator (const)
         /// @noexcept
-        const_iterator end() const noexcept { return entries.end(); }
+        const_iterator end() const noexcept { return { vars.data(), &lookup, vars.size() }; }
 
-        /// @brief Access the underlying entry vector
+        /// @brief Random-access read-only view of all entries (all()[k], all().size())
         /// @noexcept
-        const std::vector<Entry>& all() const noexcept { return entries; }
+        std::ranges::subrange<const_iterator> all() const noexcept { return { begin(), end() }; }
 
         // ========================================================================
         // ACCESS (VARIADIC INDICES)
@@ -661,17 +795,18 @@ class VariableGroup {
          * @param idx Index values
          * @return Mutable reference to the GRBVar
          * @throws std::out_of_range if index not found
-         * @complexity O(1) average (hash lookup)
+         * @complexity O(1) average (hash lookup, no allocation)
          */
         template<typename... I>
         GRBVar& at(I... idx) {
-            std::string key = makeKey(idx...);
-            auto it = indexMap.find(key);
-            if (it == indexMap.end()) {
+            static_assert((std::is_integral_v<I> && ...),
+                "IndexedVariableSet::at: indices must be integral");
+            const std::size_t pos = lookup.find(idx...);
+            if (pos == TupleIndex::npos) {
                 throw std::out_of_range(
-                    std::format("IndexedVariableSet::at: index {} not found", key));
+                    std::format("IndexedVariableSet::at: index {} not found", makeKey(idx...)));
             }
-            return entries[it->second].var;
+            return vars[pos];
         }
 
         /// @brief Const version of at()
@@ -698,17 +833,10 @@ class VariableGroup {
          */
         template<typename... I>
         GRBVar* try_get(I... idx) noexcept {
-            try {
-                std::string key = makeKey(idx...);
-                auto it = indexMap.find(key);
-                if (it == indexMap.end()) {
-                    return nullptr;
-                }
-                return &entries[it->second].var;
-            }
-            catch (...) {
-                return nullptr;
-            }
+            static_assert((std::is_integral_v<I> && ...),
+                "IndexedVariableSet::try_get: indices must be integral");
+            const std::size_t pos = lookup.find(idx...);
+            return pos == TupleIndex::npos ? nullptr : &vars[pos];
         }
 
         /// @brief Const version of try_get()
@@ -731,17 +859,8 @@ class VariableGroup {
          * @note idxVec can have any length (matches how the domain was built).
          */
         GRBVar* try_get(const std::vector<int>& idxVec) noexcept {
-            try {
-                std::string key = makeKeyFromVector(idxVec);
-                auto it = indexMap.find(key);
-                if (it == indexMap.end()) {
-                    return nullptr;
-                }
-                return &entries[it->second].var;
-            }
-            catch (...) {
-                return nullptr;
-            }
+            const std::size_t pos = lookup.find(idxVec);
+            return pos == TupleIndex::npos ? nullptr : &vars[pos];
         }
 
         /// @brief Const version of try_get(vector)
@@ -749,6 +868,17 @@ class VariableGroup {
             return const_cast<IndexedVariableSet*>(this)->try_get(idxVec);
         }
 
+        /// @brief try_get() from a packed index tuple (e.g. Entry::index)
+        GRBVar* try_get(std::span<const int> idx) noexcept {
+            const std::size_t pos = lookup.find(idx);
+            return pos == TupleIndex::npos ? nullptr : &vars[pos];
+        }
+
+        /// @brief Const version of try_get(span)
+        const GRBVar* try_get(std::span<const int> idx) const noexcept {
+            return const_cast<IndexedVariableSet*>(this)->try_get(idx);
+        }
+
         /**
          * @brief Access variable by index vector
          * @param idxVec Vector of index values
@@ -778,6 +908,21 @@ class VariableGroup {
             return const_cast<IndexedVariableSet*>(this)->at(idxVec);
         }
 
+        /// @brief at() from a packed index tuple (e.g. Entry::index)
+        GRBVar& at(std::span<const int> idx) {
+            GRBVar* v = try_get(idx);
+            if (!v) {
+                throw std::out_of_range(
+                    std::format("IndexedVariableSet::at: index {} not found", makeKeyFromVector(idx)));
+            }
+            return *v;
+        }
+
+        /// @brief Const version of at(span)
+        const GRBVar& at(std::span<const int> idx) const {
+            return const_cast<IndexedVariableSet*>(this)->at(idx);
+        }
+
         // ========================================================================
         // FOREACH ITERATION
         // ========================================================================
@@ -788,6 +933,10 @@ class VariableGroup {
          * @param fn Function to call for each entry
          * @complexity O(size())
          *
+         * @note Each index is copied into one scratch vector reused for the
+         *       whole call (the VariableGroup::forEach signature); iterate
+         *       begin()/end() for copy-free span views.
+         *
          * @example
          *     X.forEach([](GRBVar& v, const std::vector<int>& idx) {
          *         std::cout << "X";
@@ -797,22 +946,521 @@ class VariableGroup {
          */
         template<typename Fn>
         void forEach(Fn&& fn) {
-            for (auto& e : entries) {
-                fn(e.var, e.index);
-            }
+            forEachImpl(*this, fn);
         }
 
         /// @brief Const version of forEach()
         template<typename Fn>
         void forEach(Fn&& fn) const
         {
-            for (const auto& e : entries) {
-                fn(e.var, e.index);
+            forEachImpl(*this, fn);
+        }
+
+    private:
+        friend class VariableFactory;
+        template<std::size_t> friend class SparseVars;
+    };
+
+
+    // ============================================================================
+    // STATICALLY RANKED VARIABLE ARRAY
+    // ============================================================================
+    /**
+     * @class VarArray
+     * @brief Dense row-major variable array whose rank N is a template parameter
+     *
+     * @details Same layout as VariableGroup (one contiguous GRBVar buffer),
+     *          but shape, strides and indices are std::array<.., N>:
+     *           at() with the wrong number of indices does not compile
+     *           forEach passes `const std::array<int, N>&` (no vector)
+     *
+     *          Converts from a VariableGroup of rank N (moving its buffer
+     *          when given an rvalue) and back via explicit conversion.
+     *
+     * @tparam N Number of dimensions (>= 1)
+     *
+     * @example
+     *     dsl::VarArray<2> X(VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 10, 20));
+     *     X(3, 5);                                  // X(3) fails to compile
+     *     X.forEach([](GRBVar& v, const std::array<int, 2>& idx) { ... });
+     *     auto G = static_cast<dsl::VariableGroup>(X);
+     *
+     * @see VariableGroup
+     */
+    template<std::size_t N>
+    class VarArray : public FlatTraversal<VarArray<N>> {
+        static_assert(N >= 1, "VarArray: rank must be at least 1 (use GRBVar for scalars)");
+
+    public:
+        using index_type = std::array<int, N>;   ///< Index tuple type
+        using shape_type = std::array<std::size_t, N>;
+
+    private:
+        std::vector<GRBVar> data;       ///< Row-major element buffer
+        shape_type extents{};           ///< Size of each dimension
+        shape_type strides{};           ///< Row-major stride of each dimension
+        GRBModel* owner = nullptr;      ///< Model holding the variables (if known)
+
+    public:
+        // ========================================================================
+        // CONSTRUCTORS / CONVERSION
+        // ========================================================================
+
+        /// @brief Default constructor; creates an empty array (all extents 0)
+        VarArray() = default;
+
+        /**
+         * @brief Construct from a row-major buffer and its shape
+         * @throws std::invalid_argument if vars.size() != product of shp
+         */
+        VarArray(std::vector<GRBVar>&& vars, const shape_type& shp)
+            : data(std::move(vars)), extents(shp) {
+            computeStrides();
+            checkSize();
+        }
+
+        /**
+         * @brief Copy a VariableGroup of rank N
+         * @throws std::invalid_argument if g.dimension() != N
+         */
+        explicit VarArray(const VariableGroup& g)
+            : data(g.data), owner(g.owner) {
+            takeShape(g);
+        }
+
+        /**
+         * @brief Take over the buffer of a VariableGroup of rank N
+         * @throws std::invalid_argument if g.dimension() != N (g is left unchanged)
+         */
+        explicit VarArray(VariableGroup&& g)
+            : owner(g.owner) {
+            takeShape(g);
+            data = std::move(g.data);
+        }
+
+        /// @brief Runtime-ranked copy (same buffer order and model)
+        explicit operator VariableGroup() const {
+            VariableGroup g(std::vector<GRBVar>(data), std::vector<std::size_t>(extents.begin(), extents.end()));
+            g.owner = owner;
+            return g;
+        }
+
+        // ========================================================================
+        // INTROSPECTION
+        // ========================================================================
+
+        /// @brief Number of dimensions (compile-time constant)
+        [[nodiscard]] static constexpr std::size_t rank() noexcept { return N; }
+
+        /// @brief Size of each dimension
+        /// @noexcept
+        [[nodiscard]] const shape_type& shape() const noexcept { return extents; }
+
+        /// @brief Size of dimension D (checked at compile time)
+        template<std::size_t D>
+        [[nodiscard]] std::size_t size() const noexcept {
+            static_assert(D < N, "VarArray::size<D>: dimension out of range");
+            return extents[D];
+        }
+
+        /// @brief Total number of variables
+        /// @noexcept
+        [[nodiscard]] std::size_t count() const noexcept { return data.size(); }
+
+        /// @brief Contiguous row-major view of all variables (forEach order)
+        [[nodiscard]] std::span<GRBVar> flat() noexcept { return data; }
+
+        /// @brief Const version of flat()
+        [[nodiscard]] std::span<const GRBVar> flat() const noexcept { return data; }
+
+        /// @brief Model the variables belong to (nullptr if unknown)
+        [[nodiscard]] GRBModel* model() const noexcept { return owner; }
+
+        /// @brief Record the model holding the variables (enables bulk queries)
+        void setModel(GRBModel& m) noexcept { owner = &m; }
+
+        // ========================================================================
+        // ACCESS
+        // ========================================================================
+
+        /**
+         * @brief Access variable by N integral indices
+         * @throws std::out_of_range if any index is out of bounds
+         * @complexity O(N) arithmetic over fixed-size arrays
+         */
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        GRBVar& at(I... idx) {
+            std::size_t offset = 0;
+            std::size_t d = 0;
+            ((offset += checkedIndex(static_cast<long long>(idx), d) * strides[d], ++d), ...);
+            return data[offset];
+        }
+
+        /// @brief Const version of at()
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        const GRBVar& at(I... idx) const {
+            return const_cast<VarArray*>(this)->at(idx...);
+        }
+
+        /// @brief Access variable by index tuple
+        GRBVar& at(const index_type& idx) {
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d < N; ++d) {
+                offset += checkedIndex(idx[d], d) * strides[d];
+            }
+            return data[offset];
+        }
+
+        /// @brief Const version of at(index_type)
+        const GRBVar& at(const index_type& idx) const {
+            return const_cast<VarArray*>(this)->at(idx);
+        }
+
+        /// @brief Alias for at() using function call syntax
+        template<typename... I>
+        GRBVar& operator()(I... idx) { return at(idx...); }
+
+        /// @brief Const alias for at() using function call syntax
+        template<typename... I>
+        const GRBVar& operator()(I... idx) const { return at(idx...); }
+
+        // ========================================================================
+        // ITERATION
+        // ========================================================================
+
+        /**
+         * @brief Call fn(GRBVar&, const std::array<int, N>&) for every variable
+         * @complexity O(count()); linear scan with an odometer index on the stack
+         */
+        template<typename Fn>
+        void forEach(Fn&& fn) {
+            forEachImpl(*this, fn);
+        }
+
+        /// @brief Const version of forEach()
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            forEachImpl(*this, fn);
+        }
+
+    private:
+        void computeStrides() noexcept {
+            strides[N - 1] = 1;
+            for (std::size_t d = N - 1; d-- > 0; ) {
+                strides[d] = strides[d + 1] * extents[d + 1];
+            }
+        }
+
+        void checkSize() const {
+            std::size_t expected = 1;
+            for (std::size_t e : extents) {
+                expected *= e;
+            }
+            if (data.size() != expected) {
+                throw std::invalid_argument(
+                    std::format("VarArray: {} variables do not match shape of {} elements",
+                        data.size(), expected));
+            }
+        }
+
+        void takeShape(const VariableGroup& g) {
+            if (g.dims != static_cast<int>(N)) {
+                throw std::invalid_argument(
+                    std::format("VarArray<{}>: VariableGroup has {} dimensions", N, g.dims));
+            }
+            std::copy(g.extents.begin(), g.extents.end(), extents.begin());
+            std::copy(g.strides.begin(), g.strides.end(), strides.begin());
+        }
+
+        [[nodiscard]] std::size_t checkedIndex(long long i, std::size_t d) const {
+            if (i < 0 || static_cast<unsigned long long>(i) >= extents[d]) {
+                throw std::out_of_range(
+                    std::format("VarArray::at: index {} out of range [0, {}) at dim {}",
+                        i, extents[d], d));
+            }
+            return static_cast<std::size_t>(i);
+        }
+
+        template<typename Self, typename Fn>
+        static void forEachImpl(Self& self, Fn& fn) {
+            index_type idx{};
+            for (std::size_t k = 0; k < self.data.size(); ++k) {
+                fn(self.data[k], std::as_const(idx));
+                for (std::size_t d = N; d-- > 0; ) {
+                    if (static_cast<std::size_t>(++idx[d]) < self.extents[d]) break;
+                    idx[d] = 0;
+                }
+            }
+        }
+    };
+
+
+    // ============================================================================
+    // STATICALLY RANKED SPARSE VARIABLES
+    // ============================================================================
+    /**
+     * @class SparseVars
+     * @brief Domain-indexed variables whose index arity N is a template parameter
+     *
+     * @details Same storage as IndexedVariableSet (contiguous GRBVar array
+     *          plus TupleIndex key block), with std::array<int, N> indices:
+     *           at()/try_get() with the wrong number of indices do not compile
+     *           forEach passes `const std::array<int, N>&`
+     *           iteration yields Entry{ GRBVar&, std::array<int, N> }
+     *
+     *          Converts from an IndexedVariableSet of arity N (moving its
+     *          storage when given an rvalue) and back via explicit conversion.
+     *
+     * @tparam N Index arity (>= 1)
+     *
+     * @example
+     *     dsl::SparseVars<2> Y(VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "Y",
+     *         (I * J) | dsl::filter([](int i, int j) { return i < j; })));
+     *     Y(1, 2);
+     *     for (const auto& [var, idx] : Y) { ... }   // idx: std::array<int, 2>
+     *
+     * @see IndexedVariableSet
+     */
+    template<std::size_t N>
+    class SparseVars : public FlatTraversal<SparseVars<N>> {
+        static_assert(N >= 1, "SparseVars: arity must be at least 1");
+
+    public:
+        using index_type = std::array<int, N>;   ///< Index tuple type
+
+        /// @brief View of one variable and a copy of its index tuple
+        struct Entry {
+            GRBVar& var;        ///< The decision variable
+            index_type index;   ///< Index tuple for this variable
+
+            Entry(GRBVar& v, std::span<const int> key) noexcept : var(v) {
+                std::copy_n(key.begin(), N, index.begin());
+            }
+        };
+
+        /// @brief Read-only Entry view (const iteration)
+        struct ConstEntry {
+            const GRBVar& var;  ///< The decision variable
+            index_type index;   ///< Index tuple for this variable
+
+            ConstEntry(const GRBVar& v, std::span<const int> key) noexcept : var(v) {
+                std::copy_n(key.begin(), N, index.begin());
+            }
+        };
+
+        using iterator = KeyedIterator<Entry, GRBVar>;
+        using const_iterator = KeyedIterator<ConstEntry, const GRBVar>;
+
+    private:
+        std::vector<GRBVar> vars;     ///< Variables in entry order, contiguous
+        TupleIndex lookup;            ///< Packed index tuples + hash index
+        GRBModel* owner = nullptr;    ///< Model holding the variables (if known)
+
+    public:
+        // ========================================================================
+        // CONSTRUCTORS / CONVERSION
+        // ========================================================================
+
+        /// @brief Default constructor; creates an empty set
+        SparseVars() = default;
+
+        /**
+         * @brief Copy an IndexedVariableSet of arity N
+         * @throws std::invalid_argument if the set's arity is not N
+         */
+        explicit SparseVars(const IndexedVariableSet& s)
+            : vars(s.vars), lookup(s.lookup), owner(s.owner) {
+            checkArity(s.lookup);
+        }
+
+        /**
+         * @brief Take over the storage of an IndexedVariableSet of arity N
+         * @throws std::invalid_argument if the set's arity is not N (s is left unchanged)
+         */
+        explicit SparseVars(IndexedVariableSet&& s)
+            : owner(s.owner) {
+            checkArity(s.lookup);
+            vars = std::move(s.vars);
+            lookup = std::move(s.lookup);
+        }
+
+        /// @brief Runtime-arity copy (same entry order, lookup layout and model)
+        explicit operator IndexedVariableSet() const {
+            IndexedVariableSet s;
+            s.vars = vars;
+            s.lookup = lookup;
+            s.owner = owner;
+            return s;
+        }
+
+        // ========================================================================
+        // INTROSPECTION
+        // ========================================================================
+
+        /// @brief Index arity (compile-time constant)
+        [[nodiscard]] static constexpr std::size_t arity() noexcept { return N; }
+
+        /// @brief Number of variables
+        /// @noexcept
+        [[nodiscard]] std::size_t size() const noexcept { return vars.size(); }
+
+        /// @brief Returns true if the set is empty
+        /// @noexcept
+        [[nodiscard]] bool empty() const noexcept { return vars.empty(); }
+
+        /// @brief Contiguous view of all variables in entry order
+        [[nodiscard]] std::span<const GRBVar> flat() const noexcept { return vars; }
+
+        /// @brief Mutable version of flat()
+        [[nodiscard]] std::span<GRBVar> flat() noexcept { return vars; }
+
+        /// @brief Model the variables belong to (nullptr if unknown)
+        [[nodiscard]] GRBModel* model() const noexcept { return owner; }
+
+        /// @brief True if lookups use the dense rank bitmap (see TupleIndex::densify())
+        [[nodiscard]] bool denseLookup() const noexcept { return lookup.dense(); }
+
+        // ========================================================================
+        // ITERATION
+        // ========================================================================
+
+        iterator begin() noexcept { return { vars.data(), &lookup, 0 }; }
+        iterator end() noexcept { return { vars.data(), &lookup, vars.size() }; }
+        const_iterator begin() const noexcept { return { vars.data(), &lookup, 0 }; }
+        const_iterator end() const noexcept { return { vars.data(), &lookup, vars.size() }; }
+
+        /**
+         * @brief Call fn(GRBVar&, const std::array<int, N>&) for every entry
+         * @complexity O(size()); the index is copied into a stack array
+         */
+        template<typename Fn>
+        void forEach(Fn&& fn) {
+            forEachImpl(*this, fn);
+        }
+
+        /// @brief Const version of forEach()
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            forEachImpl(*this, fn);
+        }
+
+        // ========================================================================
+        // ACCESS
+        // ========================================================================
+
+        /**
+         * @brief Access variable by N integral indices
+         * @throws std::out_of_range if the index is not in the set (including
+         *         indices outside int range)
+         * @complexity O(1) average, no allocation
+         */
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        GRBVar& at(I... idx) {
+            if (!(TupleIndex::fitsKey(idx) && ...)) {
+                throw std::out_of_range(
+                    std::format("SparseVars::at: index {} not found", keyText(idx...)));
+            }
+            return at(index_type{ static_cast<int>(idx)... });
+        }
+
+        /// @brief Const version of at()
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        const GRBVar& at(I... idx) const {
+            return const_cast<SparseVars*>(this)->at(idx...);
+        }
+
+        /// @brief Access variable by index tuple
+        GRBVar& at(const index_type& idx) {
+            GRBVar* v = try_get(idx);
+            if (!v) {
+                throw std::out_of_range(
+                    std::format("SparseVars::at: index {} not found", keyText(idx)));
+            }
+            return *v;
+        }
+
+        /// @brief Const version of at(index_type)
+        const GRBVar& at(const index_type& idx) const {
+            return const_cast<SparseVars*>(this)->at(idx);
+        }
+
+        /// @brief Alias for at() using function call syntax
+        template<typename... I>
+        GRBVar& operator()(I... idx) { return at(idx...); }
+
+        /// @brief Const alias for at() using function call syntax
+        template<typename... I>
+        const GRBVar& operator()(I... idx) const { return at(idx...); }
+
+        /// @brief Pointer to the variable, or nullptr if the index is not in the set
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        GRBVar* try_get(I... idx) noexcept {
+            if (!(TupleIndex::fitsKey(idx) && ...)) {
+                return nullptr;
+            }
+            return try_get(index_type{ static_cast<int>(idx)... });
+        }
+
+        /// @brief Const version of try_get()
+        template<typename... I>
+            requires (sizeof...(I) == N && (std::is_integral_v<I> && ...))
+        const GRBVar* try_get(I... idx) const noexcept {
+            return const_cast<SparseVars*>(this)->try_get(idx...);
+        }
+
+        /// @brief try_get() by index tuple
+        GRBVar* try_get(const index_type& idx) noexcept {
+            const std::size_t pos = lookup.find(idx);
+            return pos == TupleIndex::npos ? nullptr : &vars[pos];
+        }
+
+        /// @brief Const version of try_get(index_type)
+        const GRBVar* try_get(const index_type& idx) const noexcept {
+            return const_cast<SparseVars*>(this)->try_get(idx);
+        }
+
+    private:
+        static void checkArity(const TupleIndex& keys) {
+            if (keys.arity() >= 0 && keys.arity() != static_cast<int>(N)) {
+                throw std::invalid_argument(
+                    std::format("SparseVars<{}>: IndexedVariableSet has arity {}", N, keys.arity()));
+            }
+        }
+
+        static std::string keyText(const index_type& idx) {
+            std::string out;
+            for (std::size_t d = 0; d < N; ++d) {
+                if (d > 0) {
+                    out += '_';
+                }
+                out += std::to_string(idx[d]);
             }
+            return out;
         }
 
-    private:
-        friend class VariableFactory;
+        /// @brief keyText() for raw indices that may not fit in int
+        template<typename... I>
+            requires (std::is_integral_v<I> && ...)
+        static std::string keyText(I... idx) {
+            std::string out;
+            ((out += (out.empty() ? "" : "_") + std::to_string(idx)), ...);
+            return out;
+        }
+
+        template<typename Self, typename Fn>
+        static void forEachImpl(Self& self, Fn& fn) {
+            index_type idx;
+            for (std::size_t k = 0; k < self.vars.size(); ++k) {
+                const auto key = self.lookup.key(k);
+                std::copy_n(key.begin(), N, idx.begin());
+                fn(self.vars[k], std::as_const(idx));
+            }
+        }
     };
 
 
@@ -850,7 +1498,7 @@ class VariableGroup {
      * @see IndexedVariableSet
      * @see VariableTable
      */
-    class VariableContainer {
+    class VariableContainer : public FlatTraversal<VariableContainer> {
     public:
         /// @brief Storage mode enumeration
         enum class Mode { Empty, Dense, Sparse };
@@ -1158,6 +1806,26 @@ class VariableGroup {
                     throw std::runtime_error("VariableContainer::forEach: container is empty");
             }
         }
+
+        /**
+         * @brief Contiguous view of all variables in forEach order
+         * @throws std::runtime_error if container is empty
+         */
+        [[nodiscard]] std::span<GRBVar> flat() {
+            switch (mode()) {
+                case Mode::Dense:
+                    return std::get<VariableGroup>(storage_).flat();
+                case Mode::Sparse:
+                    return std::get<IndexedVariableSet>(storage_).flat();
+                default:
+                    throw std::runtime_error("VariableContainer::flat: container is empty");
+            }
+        }
+
+        /// @brief Const version of flat()
+        [[nodiscard]] std::span<const GRBVar> flat() const {
+            return const_cast<VariableContainer*>(this)->flat();
+        }
     };
 
 
@@ -1181,25 +1849,22 @@ class VariableGroup {
         template<typename T>
         inline constexpr bool is_tuple_like_v = is_tuple_like<T>::value;
 
-        /// @brief Convert domain element to index vector
+        /// @brief Convert domain element to a fixed-size index array (no allocation)
         template<typename Idx>
-        std::vector<int> index_to_vector(const Idx& idx) {
+        auto index_to_array(const Idx& idx) {
             using Raw = std::remove_cvref_t<Idx>;
             if constexpr (is_tuple_like_v<Raw>) {
-                std::vector<int> v;
-                v.reserve(static_cast<std::size_t>(std::tuple_size_v<Raw>));
-                std::apply(
-                    [&](auto&&... args) {
-                        (v.push_back(static_cast<int>(args)), ...);
+                return std::apply(
+                    [](auto&&... args) {
+                        return std::array<int, sizeof...(args)>{ static_cast<int>(args)... };
                     },
                     idx
                 );
-                return v;
             }
             else {
                 static_assert(std::is_integral_v<Raw>,
-                    "variable_detail::index_to_vector: index must be int or tuple");
-                return std::vector<int>{ static_cast<int>(idx) };
+                    "variable_detail::index_to_array: index must be int or tuple");
+                return std::array<int, 1>{ static_cast<int>(idx) };
             }
         }
 
@@ -1218,6 +1883,8 @@ class VariableGroup {
      *           addIndexed(): Creates IndexedVariableSet from domain objects
      *
      * @note Variables are named using naming.h utilities when naming_enabled() is true.
+     * @note Non-scalar creation enumerates the index space once and creates the
+     *       variables in chunks of batchSize() through GRBModel::addVars.
      *
      * @example
      *     // Scalar
@@ -1275,12 +1942,31 @@ class VariableGroup {
                 return addVarOpt(model, lb, ub, vtype, name);
             }
             else {
-                std::vector<int> indices;
-                Node root = addNodeImpl(model, vtype, lb, ub,
-                    baseName, indices, sizes...);
+                const std::array<int, sizeof...(Sizes)> shp =
+                    checkedShape(sizes...);
+
+                std::size_t total = 1;
+                for (int s : shp) {
+                    total *= static_cast<std::size_t>(s);
+                }
 
-                return VariableGroup(std::move(root),
-                    static_cast<int>(sizeof...(sizes)));
+                // Names are produced in row-major order, matching addVars order
+                std::vector<int> idx(shp.size(), 0);
+                std::vector<GRBVar> flat = addVarsBatched(model, vtype, lb, ub,
+                    total,
+                    [&](std::size_t) {
+                        std::string name = ::make_name::index(baseName, idx);
+                        for (std::size_t d = idx.size(); d-- > 0; ) {
+                            if (++idx[d] < shp[d]) break;
+                            idx[d] = 0;
+                        }
+                        return name;
+                    });
+
+                VariableGroup result(std::move(flat),
+                    std::vector<std::size_t>(shp.begin(), shp.end()));
+                result.owner = &model;
+                return result;
             }
         }
 
@@ -1313,20 +1999,53 @@ class VariableGroup {
             const Domain& domain)
         {
             IndexedVariableSet result;
+            result.owner = &model;
 
+            // Enumerate the domain once, packing the indices straight into
+            // the lookup's key block (no per-entry index vector)
             for (auto&& rawIdx : domain) {
-                auto idxVec = variable_detail::index_to_vector(rawIdx);
+                result.lookup.insert(variable_detail::index_to_array(rawIdx));
+            }
+
+            result.vars = addVarsBatched(model, vtype, lb, ub,
+                result.lookup.size(),
+                [&](std::size_t k) {
+                    return ::make_name::index(baseName, result.lookup.key(k));
+                });
+            // Subsets of a box (filtered Cartesian products) switch to the
+            // rank-bitmap lookup; sparse key sets keep the hash table
+            result.lookup.densify();
+
+            return result;
+        }
+
+        // ========================================================================
+        // BATCH CONFIGURATION
+        // ========================================================================
 
-                std::string name =
-                    naming_enabled()
-                    ? ::make_name::index(baseName, idxVec)
-                    : std::string{};
+        /// @brief Default number of variables created per GRBModel::addVars call
+        static constexpr std::size_t DEFAULT_BATCH_SIZE = 65536;
 
-                GRBVar v = addVarOpt(model, lb, ub, vtype, name);
-                result.addEntry(std::move(v), std::move(idxVec));
+        /**
+         * @brief Set the number of variables created per GRBModel::addVars call
+         * @param n Chunk size used by add() and addIndexed()
+         * @throws std::invalid_argument if n == 0 or n > INT_MAX
+         *
+         * @note Larger chunks mean fewer API calls but larger temporary
+         *       bound/type/name arrays. The setting is process-wide.
+         */
+        static void setBatchSize(std::size_t n) {
+            if (n == 0 || n > static_cast<std::size_t>(INT_MAX)) {
+                throw std::invalid_argument(
+                    std::format("VariableFactory::setBatchSize: invalid size {}", n));
             }
+            batchSizeValue.store(n, std::memory_order_relaxed);
+        }
 
-            return result;
+        /// @brief Returns the current addVars chunk size
+        /// @noexcept
+        [[nodiscard]] static std::size_t batchSize() noexcept {
+            return batchSizeValue.load(std::memory_order_relaxed);
         }
 
     private:
@@ -1334,45 +2053,65 @@ class VariableGroup {
         // PRIVATE HELPERS
         // ========================================================================
 
-        /// @brief Recursive tree construction for rectangular variables
-        template<typename SizeType, typename... Sizes>
-        static Node addNodeImpl(GRBModel& model,
+        inline static std::atomic<std::size_t> batchSizeValue{ DEFAULT_BATCH_SIZE };
+
+        /// @brief Validate dimension sizes and convert them to int
+        template<typename... Sizes>
+        static std::array<int, sizeof...(Sizes)> checkedShape(Sizes... sizes) {
+            std::array<int, sizeof...(Sizes)> shp{};
+            std::size_t d = 0;
+            ((sizes < 0
+                ? throw std::invalid_argument(
+                    std::format("VariableFactory::add: negative size {}", sizes))
+                : void(shp[d++] = static_cast<int>(sizes))), ...);
+            return shp;
+        }
+
+        /**
+         * @brief Create `count` variables with identical bounds and type
+         *        through chunked GRBModel::addVars calls
+         * @param nameAt Callable (std::size_t k) -> std::string; invoked in
+         *        order k = 0..count-1, and only when naming_enabled()
+         * @return Variables in creation order
+         */
+        template<typename NameFn>
+        static std::vector<GRBVar> addVarsBatched(GRBModel& model,
             int vtype,
             double lb,
             double ub,
-            const std::string& baseName,
-            std::vector<int>& idx,
-            SizeType n,
-            Sizes... sizes)
+            std::size_t count,
+            NameFn&& nameAt)
         {
-            static_assert(std::is_integral_v<SizeType>,
-                "VariableFactory::addNodeImpl: size must be integral");
-
-            if (n < 0) {
-                throw std::invalid_argument(
-                    std::format("VariableFactory::addNodeImpl: negative size {}", n));
-            }
-
-            Node node(static_cast<std::size_t>(n));
-
-            for (SizeType i = 0; i < n; ++i) {
-                idx.push_back(static_cast<int>(i));
-
-                if constexpr (sizeof...(Sizes) == 0) {
-                    std::string name = ::make_name::index(baseName, idx);
-                    node.children[static_cast<std::size_t>(i)] =
-                        Node(addVarOpt(model, lb, ub, vtype, name));
-                }
-                else {
-                    node.children[static_cast<std::size_t>(i)] =
-                        addNodeImpl(model, vtype, lb, ub,
-                            baseName, idx, sizes...);
+            std::vector<GRBVar> out;
+            out.reserve(count);
+
+            const std::size_t chunk = std::min(batchSize(), count);
+            std::vector<double> lbs(chunk, lb);
+            std::vector<double> ubs(chunk, ub);
+            std::vector<double> objs(chunk, 0.0);
+            std::vector<char> types(chunk, static_cast<char>(vtype));
+            std::vector<std::string> names;
+
+            for (std::size_t done = 0; done < count; ) {
+                const std::size_t n = std::min(chunk, count - done);
+                const std::string* namePtr = nullptr;
+
+                if constexpr (naming_enabled()) {
+                    names.resize(n);
+                    for (std::size_t k = 0; k < n; ++k) {
+                        names[k] = nameAt(done + k);
+                    }
+                    namePtr = names.data();
                 }
 
-                idx.pop_back();
+                std::unique_ptr<GRBVar[]> block(model.addVars(lbs.data(),
+                    ubs.data(), objs.data(), types.data(), namePtr,
+                    static_cast<int>(n)));
+                out.insert(out.end(), block.get(), block.get() + n);
+                done += n;
             }
 
-            return node;
+            return out;
         }
 
         /// @brief Create GRBVar with optional naming
@@ -1429,6 +2168,11 @@ class VariableGroup {
      *         auto shape = vt.get(Vars::X).asGroup().shape();
      *     }
      *
+     *     // Column index -> (key, index tuple), no names needed
+     *     model.update();
+     *     vt.indexColumns();
+     *     if (auto loc = vt.locate(col)) { ... loc->key, loc->index ... }
+     *
      * @see VariableContainer
      * @see VariableGroup
      * @see IndexedVariableSet
@@ -1437,8 +2181,29 @@ class VariableGroup {
         typename EnumT,
         std::size_t MAX = static_cast<std::size_t>(EnumT::COUNT)>
     class VariableTable {
+    public:
+        /**
+         * @struct Location
+         * @brief Container and index tuple of one model column (see locate())
+         */
+        struct Location {
+            EnumT key;                 ///< Container holding the column
+            std::size_t position;      ///< Position in the container's flat() array
+            std::vector<int> index;    ///< Index tuple (empty for a scalar)
+        };
+
     private:
+        /// @brief Consecutive columns stored consecutively in one container
+        struct ColumnRun {
+            int first;                 ///< Column index of the first variable
+            std::size_t count;         ///< Number of columns in the run
+            std::size_t slot;          ///< Container (enum value)
+            std::size_t offset;        ///< flat() position of the first variable
+        };
+
         std::array<VariableContainer, MAX> table_;  ///< Fixed-size array of containers
+        std::vector<ColumnRun> columns_;            ///< Runs sorted by first column
+        bool columnsIndexed_ = false;               ///< indexColumns() is current
 
     public:
         // ========================================================================
@@ -1458,6 +2223,7 @@ class VariableGroup {
                     std::format("VariableTable::set: key {} >= {}", idx, MAX));
             }
             table_[idx] = std::move(container);
+            columnsIndexed_ = false;
         }
 
         /**
@@ -1643,9 +2409,388 @@ class VariableGroup {
         bool isEmpty(EnumT key) const {
             return get(key).isEmpty();
         }
+
+        // ========================================================================
+        // COLUMN REVERSE INDEX
+        // ========================================================================
+
+        /**
+         * @brief Record the Gurobi column range of every container
+         * @throws std::logic_error if a variable has no column index yet
+         *         (call model.update() first)
+         * @complexity O(#variables + #runs log #runs)
+         *
+         * @details Walks each container's flat() array once and merges
+         *          consecutive column indices into runs. Containers created by
+         *          one VariableFactory call occupy a single run, so the index
+         *          has about one entry per container. Call again after the
+         *          model's columns change (e.g. variables removed) or after a
+         *          container is replaced; set() invalidates the index, and
+         *          locate() detects containers replaced through get().
+         */
+        void indexColumns() {
+            columns_.clear();
+            for (std::size_t slot = 0; slot < MAX; ++slot) {
+                if (table_[slot].isEmpty()) {
+                    continue;
+                }
+                const auto vars = table_[slot].flat();
+                for (std::size_t k = 0; k < vars.size(); ++k) {
+                    const int col = vars[k].index();
+                    if (col < 0) {
+                        throw std::logic_error(
+                            std::format("VariableTable::indexColumns: variable {} of key {} has no column index (call model.update())",
+                                k, slot));
+                    }
+                    ColumnRun* last = columns_.empty() ? nullptr : &columns_.back();
+                    if (last && last->slot == slot &&
+                        static_cast<long long>(col) == static_cast<long long>(last->first) + static_cast<long long>(last->count)) {
+                        ++last->count;
+                    }
+                    else {
+                        columns_.push_back(ColumnRun{ col, 1, slot, k });
+                    }
+                }
+            }
+            std::sort(columns_.begin(), columns_.end(),
+                [](const ColumnRun& a, const ColumnRun& b) { return a.first < b.first; });
+            columnsIndexed_ = true;
+        }
+
+        /**
+         * @brief Map a Gurobi column index back to its container and index tuple
+         * @param col Column index (GRBVar::index(), position in getVars() / a dense X array)
+         * @return Location, or std::nullopt if no container holds the column
+         * @throws std::logic_error if indexColumns() has not been called since the
+         *         last set(), or the container holding `col` changed since then
+         * @complexity O(log #runs) search; the index tuple is decoded from the
+         *             container's shape (dense) or packed keys (sparse)
+         *
+         * @example
+         *     const double* x = ...;                    // dense solution vector
+         *     for (int col = 0; col < n; ++col) {
+         *         if (auto loc = vt.locate(col); loc && x[col] > 0.5) {
+         *             report(loc->key, loc->index);
+         *         }
+         *     }
+         */
+        [[nodiscard]] std::optional<Location> locate(int col) const {
+            if (!columnsIndexed_) {
+                throw std::logic_error("VariableTable::locate: column index is stale (call indexColumns())");
+            }
+            auto it = std::upper_bound(columns_.begin(), columns_.end(), col,
+                [](int c, const ColumnRun& r) { return c < r.first; });
+            if (it == columns_.begin()) {
+                return std::nullopt;
+            }
+            --it;
+            const long long delta = static_cast<long long>(col) - it->first;
+            if (delta >= static_cast<long long>(it->count)) {
+                return std::nullopt;
+            }
+
+            Location loc{ static_cast<EnumT>(it->slot), it->offset + static_cast<std::size_t>(delta), {} };
+            const VariableContainer& c = table_[it->slot];
+            // get() hands out mutable containers, so the run may be stale
+            if (c.isEmpty() || loc.position >= c.flat().size() ||
+                c.flat()[loc.position].index() != col) {
+                throw std::logic_error(std::format(
+                    "VariableTable::locate: container {} changed since indexColumns()", it->slot));
+            }
+            if (c.isDense()) {
+                const VariableGroup& g = c.asGroup();
+                loc.index.resize(static_cast<std::size_t>(g.dimension()));
+                std::size_t rest = loc.position;
+                for (int d = 0; d < g.dimension(); ++d) {
+                    const std::size_t stride = g.stride(d);
+                    loc.index[static_cast<std::size_t>(d)] = static_cast<int>(rest / stride);
+                    rest %= stride;
+                }
+            }
+            else {
+                const auto key = c.asIndexed().all()[loc.position].index;
+                loc.index.assign(key.begin(), key.end());
+            }
+            return loc;
+        }
     };
 
 
+    // ============================================================================
+    // BULK ATTRIBUTE QUERIES
+    // ============================================================================
+    /**
+     * @defgroup AttributeQueries Bulk Attribute Queries
+     * @brief Read or write one double attribute for every variable of a container
+     *
+     * @details getAttr() collects the container's variables into a contiguous
+     *          array and reads the attribute with one array query
+     *          (GRBModel::get(attr, vars, n)) instead of one GRBVar::get()
+     *          per variable. It works for any double variable attribute:
+     *          X, RC, Start, LB, UB, Obj, ...
+     *
+     *          setAttr() is the write counterpart (GRBModel::set(attr, vars, vals, n));
+     *          fixAll(), setStartAll(), setLB() and setUB() are built on it.
+     *
+     *          Every container (VariableGroup, IndexedVariableSet,
+     *          VariableContainer) has the same overload set, mirrored by the
+     *          constraint collections:
+     *            getAttr(c, attr)            -> std::vector<double>
+     *            getAttr(c, attr, out)       -> fills std::span<double>
+     *            setAttr(c, attr, vals)
+     *          each also as getAttr(model, c, ...) / setAttr(model, c, ...).
+     *
+     *          The array calls need the owning model. Containers made by
+     *          VariableFactory record it (see VariableGroup::model()). For
+     *          containers built by hand, pass the model explicitly or call
+     *          setModel(); without either, the model-less overloads read and
+     *          write one variable at a time.
+     *
+     * @example
+     *     model.optimize();
+     *     auto x  = dsl::getAttr(X, GRB_DoubleAttr_X);    // == dsl::values(X)
+     *     auto rc = dsl::getAttr(Y, GRB_DoubleAttr_RC);
+     *     auto lb = dsl::getAttr(model, handBuilt, GRB_DoubleAttr_LB);
+     *     dsl::getAttr(X, GRB_DoubleAttr_Start, std::span(buffer)); // no allocation
+     *
+     * @{
+     */
+
+    namespace variable_detail {
+
+        /// @brief Throw std::invalid_argument unless got == expected
+        inline void checkCount(const char* what, std::size_t expected, std::size_t got) {
+            if (got != expected) {
+                throw std::invalid_argument(
+                    std::format("{}: expected {} values, got {}", what, expected, got));
+            }
+        }
+
+        /**
+         * @brief Read a double attribute for a contiguous run of variables
+         * @param model Owning model, or nullptr to fall back to per-variable reads
+         * @param vars Variables to query
+         * @param attr Attribute to read
+         * @param out One slot per variable, filled in order
+         * @throws std::invalid_argument if out.size() != vars.size()
+         *
+         * @note Runs longer than INT_MAX are split into several array queries.
+         */
+        inline void bulkGet(GRBModel* model,
+            std::span<const GRBVar> vars,
+            GRB_DoubleAttr attr,
+            std::span<double> out)
+        {
+            checkCount("getAttr", vars.size(), out.size());
+            if (model == nullptr) {
+                for (std::size_t k = 0; k < vars.size(); ++k) {
+                    out[k] = vars[k].get(attr);
+                }
+                return;
+            }
+
+            for (std::size_t done = 0; done < vars.size(); ) {
+                const int n = static_cast<int>(std::min<std::size_t>(
+                    vars.size() - done, static_cast<std::size_t>(INT_MAX)));
+                std::unique_ptr<double[]> buf(model->get(attr, vars.data() + done, n));
+                std::copy_n(buf.get(), n, out.begin() + static_cast<std::ptrdiff_t>(done));
+                done += static_cast<std::size_t>(n);
+            }
+        }
+
+        /// @brief bulkGet() into a new vector
+        inline std::vector<double> bulkGet(GRBModel* model,
+            std::span<const GRBVar> vars,
+            GRB_DoubleAttr attr)
+        {
+            std::vector<double> out(vars.size());
+            bulkGet(model, vars, attr, out);
+            return out;
+        }
+
+        /**
+         * @brief Write a double attribute for a contiguous run of variables
+         * @param model Owning model, or nullptr to fall back to per-variable writes
+         * @param vars Variables to modify
+         * @param attr Attribute to write
+         * @param vals One value per variable
+         * @throws std::invalid_argument if vals.size() != vars.size()
+         */
+        inline void bulkSet(GRBModel* model,
+            std::span<const GRBVar> vars,
+            GRB_DoubleAttr attr,
+            std::span<const double> vals)
+        {
+            checkCount("setAttr", vars.size(), vals.size());
+            if (model == nullptr) {
+                for (std::size_t k = 0; k < vars.size(); ++k) {
+                    GRBVar v = vars[k];
+                    v.set(attr, vals[k]);
+                }
+                return;
+            }
+
+            for (std::size_t done = 0; done < vars.size(); ) {
+                const int n = static_cast<int>(std::min<std::size_t>(
+                    vars.size() - done, static_cast<std::size_t>(INT_MAX)));
+                model->set(attr, vars.data() + done, vals.data() + done, n);
+                done += static_cast<std::size_t>(n);
+            }
+        }
+
+        /// @brief Variables of a non-empty container
+        /// @throws std::runtime_error if the container is empty
+        inline std::span<const GRBVar> varsOf(const VariableContainer& vc, const char* what) {
+            if (vc.isEmpty()) {
+                throw std::runtime_error(std::format("VariableContainer::{}: container is empty", what));
+            }
+            return vc.flat();
+        }
+
+        /// @brief Model recorded by a non-empty container (nullptr if built by hand)
+        inline GRBModel* modelOf(const VariableContainer& vc) {
+            return vc.isDense() ? vc.asGroup().model() : vc.asIndexed().model();
+        }
+
+    } // namespace variable_detail
+
+    /**
+     * @brief Read a double attribute for every variable of a VariableGroup
+     *
+     * @param vg The VariableGroup to query
+     * @param attr Attribute (e.g. GRB_DoubleAttr_X, _RC, _Start, _LB, _UB, _Obj)
+     * @return Values in row-major (forEach) order
+     *
+     * @throws GRBException if the attribute is not available
+     * @complexity One array query when vg.model() is set, otherwise n queries
+     */
+    inline std::vector<double> getAttr(const VariableGroup& vg, GRB_DoubleAttr attr) {
+        return variable_detail::bulkGet(vg.model(), vg.flat(), attr);
+    }
+
+    /// @brief getAttr() into a caller buffer (out.size() must equal vg.count())
+    inline void getAttr(const VariableGroup& vg, GRB_DoubleAttr attr, std::span<double> out) {
+        variable_detail::bulkGet(vg.model(), vg.flat(), attr, out);
+    }
+
+    /// @brief getAttr() with an explicit model (for groups built without VariableFactory)
+    inline std::vector<double> getAttr(GRBModel& model, const VariableGroup& vg, GRB_DoubleAttr attr) {
+        return variable_detail::bulkGet(&model, vg.flat(), attr);
+    }
+
+    /// @brief getAttr() with an explicit model into a caller buffer
+    inline void getAttr(GRBModel& model, const VariableGroup& vg, GRB_DoubleAttr attr, std::span<double> out) {
+        variable_detail::bulkGet(&model, vg.flat(), attr, out);
+    }
+
+    /**
+     * @brief Read a double attribute for every variable of an IndexedVariableSet
+     *
+     * @param vs The IndexedVariableSet to query
+     * @param attr Attribute to read
+     * @return Values in storage (forEach) order
+     *
+     * @throws GRBException if the attribute is not available
+     * @complexity One array query over flat() when vs.model() is set
+     */
+    inline std::vector<double> getAttr(const IndexedVariableSet& vs, GRB_DoubleAttr attr) {
+        return variable_detail::bulkGet(vs.model(), vs.flat(), attr);
+    }
+
+    /// @brief getAttr() into a caller buffer (out.size() must equal vs.size())
+    inline void getAttr(const IndexedVariableSet& vs, GRB_DoubleAttr attr, std::span<double> out) {
+        variable_detail::bulkGet(vs.model(), vs.flat(), attr, out);
+    }
+
+    /// @brief getAttr() with an explicit model
+    inline std::vector<double> getAttr(GRBModel& model, const IndexedVariableSet& vs, GRB_DoubleAttr attr) {
+        return variable_detail::bulkGet(&model, vs.flat(), attr);
+    }
+
+    /// @brief getAttr() with an explicit model into a caller buffer
+    inline void getAttr(GRBModel& model, const IndexedVariableSet& vs, GRB_DoubleAttr attr, std::span<double> out) {
+        variable_detail::bulkGet(&model, vs.flat(), attr, out);
+    }
+
+    /**
+     * @brief Read a double attribute for every variable of a VariableContainer
+     *
+     * @param vc The VariableContainer to query
+     * @param attr Attribute to read
+     * @return Values in iteration order
+     *
+     * @throws std::runtime_error if container is empty
+     * @throws GRBException if the attribute is not available
+     */
+    inline std::vector<double> getAttr(const VariableContainer& vc, GRB_DoubleAttr attr) {
+        const auto vars = variable_detail::varsOf(vc, "getAttr");
+        return variable_detail::bulkGet(variable_detail::modelOf(vc), vars, attr);
+    }
+
+    /// @brief getAttr() into a caller buffer (out.size() must equal vc.count())
+    inline void getAttr(const VariableContainer& vc, GRB_DoubleAttr attr, std::span<double> out) {
+        const auto vars = variable_detail::varsOf(vc, "getAttr");
+        variable_detail::bulkGet(variable_detail::modelOf(vc), vars, attr, out);
+    }
+
+    /// @brief getAttr() with an explicit model
+    inline std::vector<double> getAttr(GRBModel& model, const VariableContainer& vc, GRB_DoubleAttr attr) {
+        return variable_detail::bulkGet(&model, variable_detail::varsOf(vc, "getAttr"), attr);
+    }
+
+    /// @brief getAttr() with an explicit model into a caller buffer
+    inline void getAttr(GRBModel& model, const VariableContainer& vc, GRB_DoubleAttr attr, std::span<double> out) {
+        variable_detail::bulkGet(&model, variable_detail::varsOf(vc, "getAttr"), attr, out);
+    }
+
+    /**
+     * @brief Write a double attribute for every variable of a VariableGroup
+     *
+     * @param vg The VariableGroup to modify
+     * @param attr Attribute (e.g. GRB_DoubleAttr_LB, _UB, _Start, _Obj)
+     * @param vals One value per variable in row-major (forEach) order
+     *
+     * @throws std::invalid_argument if vals.size() != vg.count()
+     * @throws GRBException on Gurobi API error
+     * @complexity One array call when vg.model() is set, otherwise n calls
+     */
+    inline void setAttr(const VariableGroup& vg, GRB_DoubleAttr attr, std::span<const double> vals) {
+        variable_detail::bulkSet(vg.model(), vg.flat(), attr, vals);
+    }
+
+    /// @brief setAttr() with an explicit model
+    inline void setAttr(GRBModel& model, const VariableGroup& vg, GRB_DoubleAttr attr, std::span<const double> vals) {
+        variable_detail::bulkSet(&model, vg.flat(), attr, vals);
+    }
+
+    /// @brief Write a double attribute for every variable of an IndexedVariableSet (storage order)
+    inline void setAttr(const IndexedVariableSet& vs, GRB_DoubleAttr attr, std::span<const double> vals) {
+        variable_detail::bulkSet(vs.model(), vs.flat(), attr, vals);
+    }
+
+    /// @brief setAttr() with an explicit model
+    inline void setAttr(GRBModel& model, const IndexedVariableSet& vs, GRB_DoubleAttr attr, std::span<const double> vals) {
+        variable_detail::bulkSet(&model, vs.flat(), attr, vals);
+    }
+
+    /**
+     * @brief Write a double attribute for every variable of a VariableContainer
+     * @throws std::runtime_error if container is empty
+     * @throws std::invalid_argument if vals.size() != vc.count()
+     */
+    inline void setAttr(const VariableContainer& vc, GRB_DoubleAttr attr, std::span<const double> vals) {
+        const auto vars = variable_detail::varsOf(vc, "setAttr");
+        variable_detail::bulkSet(variable_detail::modelOf(vc), vars, attr, vals);
+    }
+
+    /// @brief setAttr() with an explicit model
+    inline void setAttr(GRBModel& model, const VariableContainer& vc, GRB_DoubleAttr attr, std::span<const double> vals) {
+        variable_detail::bulkSet(&model, variable_detail::varsOf(vc, "setAttr"), attr, vals);
+    }
+
+    /** @} */ // end of AttributeQueries group
+
+
     // ============================================================================
     // SOLUTION EXTRACTION
     // ============================================================================
@@ -1658,6 +2803,9 @@ class VariableGroup {
      *          All functions require the model to be in an optimized state with
      *          a valid solution available.
      *
+     * @note values() and valuesWithIndex() are getAttr(..., GRB_DoubleAttr_X):
+     *       one array query per container when its model is known.
+     *
      * @note These functions access GRB_DoubleAttr_X which requires:
      *       - model.optimize() has been called
      *       - Optimization status is GRB_OPTIMAL or has a feasible solution
@@ -1707,11 +2855,7 @@ class VariableGroup {
      *     std::vector<double> vals = dsl::values(X);  // 12 values
      */
     inline std::vector<double> values(const VariableGroup& vg) {
-        std::vector<double> result;
-        vg.forEach([&](const GRBVar& v, const std::vector<int>&) {
-            result.push_back(v.get(GRB_DoubleAttr_X));
-        });
-        return result;
+        return getAttr(vg, GRB_DoubleAttr_X);
     }
 
     /**
@@ -1732,12 +2876,7 @@ class VariableGroup {
      *     std::vector<double> vals = dsl::values(Y);
      */
     inline std::vector<double> values(const IndexedVariableSet& vs) {
-        std::vector<double> result;
-        result.reserve(vs.size());
-        vs.forEach([&](const GRBVar& v, const std::vector<int>&) {
-            result.push_back(v.get(GRB_DoubleAttr_X));
-        });
-        return result;
+        return getAttr(vs, GRB_DoubleAttr_X);
     }
 
     /**
@@ -1757,9 +2896,11 @@ class VariableGroup {
      *     }
      */
     inline std::vector<std::pair<std::vector<int>, double>> valuesWithIndex(const VariableGroup& vg) {
+        const std::vector<double> vals = getAttr(vg, GRB_DoubleAttr_X);
         std::vector<std::pair<std::vector<int>, double>> result;
-        vg.forEach([&](const GRBVar& v, const std::vector<int>& idx) {
-            result.emplace_back(idx, v.get(GRB_DoubleAttr_X));
+        result.reserve(vals.size());
+        vg.forEach([&](const GRBVar&, const std::vector<int>& idx) {
+            result.emplace_back(idx, vals[result.size()]);
         });
         return result;
     }
@@ -1781,11 +2922,13 @@ class VariableGroup {
      *     }
      */
     inline std::vector<std::pair<std::vector<int>, double>> valuesWithIndex(const IndexedVariableSet& vs) {
+        const std::vector<double> vals = getAttr(vs, GRB_DoubleAttr_X);
         std::vector<std::pair<std::vector<int>, double>> result;
-        result.reserve(vs.size());
-        vs.forEach([&](const GRBVar& v, const std::vector<int>& idx) {
-            result.emplace_back(idx, v.get(GRB_DoubleAttr_X));
-        });
+        result.reserve(vals.size());
+        for (std::size_t k = 0; k < vals.size(); ++k) {
+            const auto idx = vs.all()[k].index;
+            result.emplace_back(std::vector<int>(idx.begin(), idx.end()), vals[k]);
+        }
         return result;
     }
 
@@ -1803,11 +2946,7 @@ class VariableGroup {
      *     std::vector<double> vals = dsl::values(vc);
      */
     inline std::vector<double> values(const VariableContainer& vc) {
-        std::vector<double> result;
-        vc.forEach([&](const GRBVar& v, const std::vector<int>&) {
-            result.push_back(v.get(GRB_DoubleAttr_X));
-        });
-        return result;
+        return getAttr(vc, GRB_DoubleAttr_X);
     }
 
     /**
@@ -1821,11 +2960,10 @@ class VariableGroup {
      * @complexity O(n) where n = total number of variables
      */
     inline std::vector<std::pair<std::vector<int>, double>> valuesWithIndex(const VariableContainer& vc) {
-        std::vector<std::pair<std::vector<int>, double>> result;
-        vc.forEach([&](const GRBVar& v, const std::vector<int>& idx) {
-            result.emplace_back(idx, v.get(GRB_DoubleAttr_X));
-        });
-        return result;
+        if (vc.isEmpty()) {
+            throw std::runtime_error("VariableContainer::valuesWithIndex: container is empty");
+        }
+        return vc.isDense() ? valuesWithIndex(vc.asGroup()) : valuesWithIndex(vc.asIndexed());
     }
 
     /**
@@ -1906,6 +3044,8 @@ class VariableGroup {
      *          - Restoring original bounds after fixing
      *          - Setting start values for MIP warm starts
      *
+     * @note Container versions (fixAll, setStartAll, setLB, setUB) use array
+     *       attribute setters: fixAll() is two calls, the others one.
      * @note Modifications take effect after model.update() or at next optimize().
      * @note Fixing a binary/integer variable to a fractional value may cause issues.
      *
@@ -1914,6 +3054,7 @@ class VariableGroup {
      *     dsl::fixAll(X, solution);            // Fix entire group
      *     dsl::unfix(x, 0.0, 1.0);             // Restore bounds
      *     dsl::setStart(X, warmStartValues);   // Provide MIP start
+     *     dsl::setUB(X, capacities);           // Bounds for a whole group
      *
      * @{
      */
@@ -1994,10 +3135,10 @@ class VariableGroup {
      *
      * @throws std::invalid_argument if vals.size() doesn't match variable count
      * @throws GRBException on Gurobi API error
-     * @complexity O(n) where n = number of variables
+     * @complexity Two array attribute calls (LB, UB) when vg.model() is set
      *
      * @note Values must be in the same order as forEach iteration (row-major).
-     * @note Use unfixAll() to restore original bounds.
+     * @note Use setLB()/setUB() on the group to restore the original bounds.
      *
      * @example
      *     std::vector<double> solution = dsl::values(X);  // Save solution
@@ -2006,15 +3147,9 @@ class VariableGroup {
      *     model.optimize();
      */
     inline void fixAll(VariableGroup& vg, const std::vector<double>& vals) {
-        if (vals.size() != vg.count()) {
-            throw std::invalid_argument(
-                std::format("fixAll: expected {} values, got {}", vg.count(), vals.size()));
-        }
-
-        std::size_t i = 0;
-        vg.forEach([&](GRBVar& v, const std::vector<int>&) {
-            fix(v, vals[i++]);
-        });
+        variable_detail::checkCount("fixAll", vg.count(), vals.size());
+        setAttr(vg, GRB_DoubleAttr_LB, vals);
+        setAttr(vg, GRB_DoubleAttr_UB, vals);
     }
 
     /**
@@ -2025,22 +3160,16 @@ class VariableGroup {
      *
      * @throws std::invalid_argument if vals.size() doesn't match variable count
      * @throws GRBException on Gurobi API error
-     * @complexity O(n) where n = number of variables
+     * @complexity Two array attribute calls (LB, UB) when vs.model() is set
      *
      * @example
      *     std::vector<double> solution = dsl::values(Y);
      *     dsl::fixAll(Y, solution);
      */
     inline void fixAll(IndexedVariableSet& vs, const std::vector<double>& vals) {
-        if (vals.size() != vs.size()) {
-            throw std::invalid_argument(
-                std::format("fixAll: expected {} values, got {}", vs.size(), vals.size()));
-        }
-
-        std::size_t i = 0;
-        vs.forEach([&](GRBVar& v, const std::vector<int>&) {
-            fix(v, vals[i++]);
-        });
+        variable_detail::checkCount("fixAll", vs.size(), vals.size());
+        setAttr(vs, GRB_DoubleAttr_LB, vals);
+        setAttr(vs, GRB_DoubleAttr_UB, vals);
     }
 
     /**
@@ -2051,7 +3180,7 @@ class VariableGroup {
      *
      * @throws std::invalid_argument if vals.size() doesn't match variable count
      * @throws GRBException on Gurobi API error
-     * @complexity O(n) where n = number of variables
+     * @complexity One array attribute call when vg.model() is set
      *
      * @note Values must be in the same order as forEach iteration.
      * @note Useful for providing warm starts from previous solutions.
@@ -2063,15 +3192,8 @@ class VariableGroup {
      *     model.optimize();
      */
     inline void setStartAll(VariableGroup& vg, const std::vector<double>& vals) {
-        if (vals.size() != vg.count()) {
-            throw std::invalid_argument(
-                std::format("setStartAll: expected {} values, got {}", vg.count(), vals.size()));
-        }
-
-        std::size_t i = 0;
-        vg.forEach([&](GRBVar& v, const std::vector<int>&) {
-            setStart(v, vals[i++]);
-        });
+        variable_detail::checkCount("setStartAll", vg.count(), vals.size());
+        setAttr(vg, GRB_DoubleAttr_Start, vals);
     }
 
     /**
@@ -2082,7 +3204,7 @@ class VariableGroup {
      *
      * @throws std::invalid_argument if vals.size() doesn't match variable count
      * @throws GRBException on Gurobi API error
-     * @complexity O(n) where n = number of variables
+     * @complexity One array attribute call when vs.model() is set
      *
      * @example
      *     std::vector<double> prevSolution = dsl::values(Y);
@@ -2090,15 +3212,8 @@ class VariableGroup {
      *     model.optimize();
      */
     inline void setStartAll(IndexedVariableSet& vs, const std::vector<double>& vals) {
-        if (vals.size() != vs.size()) {
-            throw std::invalid_argument(
-                std::format("setStartAll: expected {} values, got {}", vs.size(), vals.size()));
-        }
-
-        std::size_t i = 0;
-        vs.forEach([&](GRBVar& v, const std::vector<int>&) {
-            setStart(v, vals[i++]);
-        });
+        variable_detail::checkCount("setStartAll", vs.size(), vals.size());
+        setAttr(vs, GRB_DoubleAttr_Start, vals);
     }
 
     /**
@@ -2110,18 +3225,12 @@ class VariableGroup {
      * @throws std::invalid_argument if vals.size() doesn't match variable count
      * @throws std::runtime_error if container is empty
      * @throws GRBException on Gurobi API error
-     * @complexity O(n) where n = number of variables
+     * @complexity Two array attribute calls (LB, UB) when the model is known
      */
     inline void fixAll(VariableContainer& vc, const std::vector<double>& vals) {
-        if (vals.size() != vc.count()) {
-            throw std::invalid_argument(
-                std::format("fixAll: expected {} values, got {}", vc.count(), vals.size()));
-        }
-
-        std::size_t i = 0;
-        vc.forEach([&](GRBVar& v, const std::vector<int>&) {
-            fix(v, vals[i++]);
-        });
+        variable_detail::checkCount("fixAll", vc.count(), vals.size());
+        setAttr(vc, GRB_DoubleAttr_LB, vals);
+        setAttr(vc, GRB_DoubleAttr_UB, vals);
     }
 
     /**
@@ -2133,18 +3242,11 @@ class VariableGroup {
      * @throws std::invalid_argument if vals.size() doesn't match variable count
      * @throws std::runtime_error if container is empty
      * @throws GRBException on Gurobi API error
-     * @complexity O(n) where n = number of variables
+     * @complexity One array attribute call when the model is known
      */
     inline void setStartAll(VariableContainer& vc, const std::vector<double>& vals) {
-        if (vals.size() != vc.count()) {
-            throw std::invalid_argument(
-                std::format("setStartAll: expected {} values, got {}", vc.count(), vals.size()));
-        }
-
-        std::size_t i = 0;
-        vc.forEach([&](GRBVar& v, const std::vector<int>&) {
-            setStart(v, vals[i++]);
-        });
+        variable_detail::checkCount("setStartAll", vc.count(), vals.size());
+        setAttr(vc, GRB_DoubleAttr_Start, vals);
     }
 
     /**
@@ -2213,6 +3315,60 @@ class VariableGroup {
         v.set(GRB_DoubleAttr_UB, bound);
     }
 
+    /**
+     * @brief Set the lower bounds of all variables in a VariableGroup
+     *
+     * @param vg VariableGroup to modify
+     * @param bounds One bound per variable in row-major (forEach) order
+     *
+     * @throws std::invalid_argument if bounds.size() doesn't match variable count
+     * @throws GRBException on Gurobi API error
+     * @complexity One array attribute call when vg.model() is set
+     */
+    inline void setLB(VariableGroup& vg, std::span<const double> bounds) {
+        variable_detail::checkCount("setLB", vg.count(), bounds.size());
+        setAttr(vg, GRB_DoubleAttr_LB, bounds);
+    }
+
+    /// @brief Set the lower bounds of all variables in an IndexedVariableSet (storage order)
+    inline void setLB(IndexedVariableSet& vs, std::span<const double> bounds) {
+        variable_detail::checkCount("setLB", vs.size(), bounds.size());
+        setAttr(vs, GRB_DoubleAttr_LB, bounds);
+    }
+
+    /// @brief Set the lower bounds of all variables in a VariableContainer
+    inline void setLB(VariableContainer& vc, std::span<const double> bounds) {
+        variable_detail::checkCount("setLB", vc.count(), bounds.size());
+        setAttr(vc, GRB_DoubleAttr_LB, bounds);
+    }
+
+    /**
+     * @brief Set the upper bounds of all variables in a VariableGroup
+     *
+     * @param vg VariableGroup to modify
+     * @param bounds One bound per variable in row-major (forEach) order
+     *
+     * @throws std::invalid_argument if bounds.size() doesn't match variable count
+     * @throws GRBException on Gurobi API error
+     * @complexity One array attribute call when vg.model() is set
+     */
+    inline void setUB(VariableGroup& vg, std::span<const double> bounds) {
+        variable_detail::checkCount("setUB", vg.count(), bounds.size());
+        setAttr(vg, GRB_DoubleAttr_UB, bounds);
+    }
+
+    /// @brief Set the upper bounds of all variables in an IndexedVariableSet (storage order)
+    inline void setUB(IndexedVariableSet& vs, std::span<const double> bounds) {
+        variable_detail::checkCount("setUB", vs.size(), bounds.size());
+        setAttr(vs, GRB_DoubleAttr_UB, bounds);
+    }
+
+    /// @brief Set the upper bounds of all variables in a VariableContainer
+    inline void setUB(VariableContainer& vc, std::span<const double> bounds) {
+        variable_detail::checkCount("setUB", vc.count(), bounds.size());
+        setAttr(vc, GRB_DoubleAttr_UB, bounds);
+    }
+
     /** @} */ // end of VariableModification group
 
 } // namespace dsl
@@ -22,6 +22,13 @@ TEST ORGANIZATION
  Section H: IndexedConstraintSet introspection and iteration
  Section I: ConstraintTable with IndexedConstraintSet
  Section J: Edge cases and error conditions
+ Section K: Free function constraint utilities
+ Section L: Batched constraint creation (addIndexedBatched)
+ Section M: ConstraintGroup flat strided storage
+ Section N: IndexedConstraintSet key lookup (variadic, std::array, std::span)
+ Section O: Bulk constraint attributes (getAttr/setAttr)
+ Section P: Parallel constraint generation (addIndexedParallel)
+ Section Q: IndexedConstraintSet structure-of-arrays entry storage
 
 TEST STRATEGY
 -------------
@@ -666,6 +673,63 @@ TEST_CASE("G3: ConstraintGroup::ScalarAccessErrors", "[ConstraintGroup][errors]"
     }
 }
 
+/**
+ * @test ConstraintGroup::IndexFreeTraversal
+ * @brief Verifies forEachConstr / forEachFlat visit storage order without index tuples
+ *
+ * @scenario Dense and sparse constraints traversed directly and through containers
+ * @given A 2x3 ConstraintGroup and a 1-D IndexedConstraintSet
+ * @when Iterating with forEachConstr and forEachFlat
+ * @then Each constraint is visited once, in flat() order, with k == its position
+ *
+ * @covers ConstraintGroup::forEachConstr, forEachFlat, IndexedConstraintSet::forEachConstr,
+ *         ConstraintContainer::forEachConstr, forEachFlat, flat
+ */
+TEST_CASE("G4: ConstraintGroup::IndexFreeTraversal", "[ConstraintGroup][iteration]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0.0, 10.0, "X", 2, 3);
+    model.update();
+
+    auto cap = dsl::ConstraintFactory::add(model, "cap",
+        [&](const std::vector<int>& idx) { return X.at(idx[0], idx[1]) <= 1.0; }, 2, 3);
+    auto flow = dsl::ConstraintFactory::addIndexed(model, "flow", dsl::IndexList{ 0, 1 },
+        [&](int i) { return X(i, 0) + X(i, 1) <= 1.0; });
+    model.update();
+
+    std::size_t seen = 0;
+    cap.forEachConstr([&](GRBConstr& c) {
+        REQUIRE(c.sameAs(cap.flat()[seen++]));
+    });
+    REQUIRE(seen == 6);
+
+    seen = 0;
+    std::as_const(cap).forEachFlat([&](std::size_t k, const GRBConstr& c) {
+        REQUIRE(k == seen++);
+        REQUIRE(c.sameAs(cap.at(static_cast<int>(k / 3), static_cast<int>(k % 3))));
+    });
+    REQUIRE(seen == 6);
+
+    seen = 0;
+    flow.forEachConstr([&](const GRBConstr& c) {
+        REQUIRE(c.sameAs(flow.at(static_cast<int>(seen++))));
+    });
+    REQUIRE(seen == 2);
+
+    dsl::ConstraintContainer dense(cap);
+    dsl::ConstraintContainer sparse(flow);
+    seen = 0;
+    dense.forEachFlat([&](std::size_t k, GRBConstr& c) {
+        REQUIRE(c.sameAs(cap.flat()[k]));
+        ++seen;
+    });
+    sparse.forEachConstr([&](GRBConstr&) { ++seen; });
+    REQUIRE(seen == 8);
+
+    dsl::ConstraintContainer none;
+    REQUIRE_THROWS_AS(none.flat(), std::runtime_error);
+}
+
 // ============================================================================
 // SECTION H: INDEXED CONSTRAINT SET INTROSPECTION
 // ============================================================================
@@ -1438,4 +1502,511 @@ TEST_CASE("K8: ConstraintUtilities::DualsCollection", "[constraints][utilities]"
             REQUIRE(std::isfinite(d));
         }
     }
-}
\ No newline at end of file
+}
+// ============================================================================
+// SECTION L: BATCHED CONSTRAINT CREATION
+// ============================================================================
+
+/// Restores the process-wide addConstrs chunk size when a test ends
+struct ConstrBatchSizeGuard {
+    std::size_t saved = dsl::ConstraintFactory::batchSize();
+    ~ConstrBatchSizeGuard() { dsl::ConstraintFactory::setBatchSize(saved); }
+};
+
+/**
+ * @test BatchedCreation::MatchesAddIndexed
+ * @brief Verifies addIndexedBatched produces the same rows as addIndexed
+ *
+ * @scenario The same filtered domain is materialized with both factories
+ * @given Chunk size 4, which does not divide the 6-row domain
+ * @when Creating rows x(i,j) + 2 y(i) <= i + j with each path
+ * @then Row order, senses, rhs, coefficients and names agree
+ *
+ * @covers ConstraintFactory::addIndexedBatched()
+ * @covers dsl::LinRow
+ */
+TEST_CASE("L1: BatchedCreation::MatchesAddIndexed", "[constraints][batch]")
+{
+    ConstrBatchSizeGuard guard;
+    dsl::ConstraintFactory::setBatchSize(4);
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 4);
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 4, 4);
+    auto Y = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "Y", 4);
+    auto D = (I * I) | dsl::filter([](int i, int j) { return i < j; });
+
+    auto serial = dsl::ConstraintFactory::addIndexed(model, "s", D,
+        [&](int i, int j) { return X(i, j) + 2.0 * Y(i) <= i + j; });
+    auto batched = dsl::ConstraintFactory::addIndexedBatched(model, "b", D,
+        [&](int i, int j) {
+            return dsl::LinRow{ X(i, j) + 2.0 * Y(i), GRB_LESS_EQUAL, double(i + j) };
+        });
+    model.update();
+
+    REQUIRE(batched.size() == serial.size());
+    REQUIRE(batched.size() == 6);
+    REQUIRE(model.get(GRB_IntAttr_NumConstrs) == 12);
+
+    auto s = serial.begin();
+    int row = 6;
+    for (const auto& e : batched) {
+        REQUIRE(std::ranges::equal(e.index, s->index));
+        REQUIRE(e.constr.index() == row++);
+        REQUIRE(e.constr.get(GRB_CharAttr_Sense) == s->constr.get(GRB_CharAttr_Sense));
+        REQUIRE(e.constr.get(GRB_DoubleAttr_RHS) == Catch::Approx(s->constr.get(GRB_DoubleAttr_RHS)));
+        REQUIRE(model.getCoeff(e.constr, X(e.index[0], e.index[1])) == Catch::Approx(1.0));
+        REQUIRE(model.getCoeff(e.constr, Y(e.index[0])) == Catch::Approx(2.0));
+        REQUIRE(batched.at(e.index[0], e.index[1]).sameAs(e.constr));
+        if (naming_enabled()) {
+            REQUIRE(e.constr.get(GRB_StringAttr_ConstrName) ==
+                std::format("b[{},{}]", e.index[0], e.index[1]));
+        }
+        ++s;
+    }
+}
+
+/**
+ * @test BatchedCreation::ConstantMovesToRhs
+ * @brief Verifies a constant in the LinRow left-hand side is moved to the rhs
+ *
+ * @covers dsl::LinRow constant handling
+ */
+TEST_CASE("L2: BatchedCreation::ConstantMovesToRhs", "[constraints][batch]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 3);
+
+    auto rows = dsl::ConstraintFactory::addIndexedBatched(model, "c",
+        dsl::IndexList{0, 1, 2},
+        [&](int i) { return dsl::LinRow{ X(i) + 1.0, GRB_GREATER_EQUAL, 5.0 }; });
+    model.setObjective(X(0) + X(1) + X(2), GRB_MINIMIZE);
+    optimizeSafe(model);
+
+    for (const auto& e : rows) {
+        REQUIRE(e.constr.get(GRB_CharAttr_Sense) == GRB_GREATER_EQUAL);
+        REQUIRE(e.constr.get(GRB_DoubleAttr_RHS) == Catch::Approx(4.0));
+        REQUIRE(X(e.index[0]).get(GRB_DoubleAttr_X) == Catch::Approx(4.0));
+    }
+}
+
+/**
+ * @test BatchedCreation::EmptyDomainAndInvalidBatchSize
+ * @brief Verifies empty domains add no rows and a zero chunk size is rejected
+ *
+ * @covers ConstraintFactory::addIndexedBatched() with empty domain
+ * @covers ConstraintFactory::setBatchSize()
+ */
+TEST_CASE("L3: BatchedCreation::EmptyDomainAndInvalidBatchSize", "[constraints][batch][edge]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 3);
+
+    auto rows = dsl::ConstraintFactory::addIndexedBatched(model, "e",
+        dsl::IndexList{},
+        [&](int i) { return dsl::LinRow{ X(i), GRB_EQUAL, 0.0 }; });
+    model.update();
+
+    REQUIRE(rows.empty());
+    REQUIRE(model.get(GRB_IntAttr_NumConstrs) == 0);
+    REQUIRE_THROWS_AS(dsl::ConstraintFactory::setBatchSize(0), std::invalid_argument);
+}
+
+// ============================================================================
+// SECTION M: CONSTRAINTGROUP FLAT STRIDED STORAGE
+// ============================================================================
+
+/**
+ * @test FlatStorage::RowMajorLayout
+ * @brief Verifies ConstraintGroup stores rows contiguously in row-major order
+ *
+ * @scenario A 3x4 constraint group is created
+ * @given cap(i,j): X(i,j) <= 10*i + j
+ * @when Comparing at(i,j), flat() and model row order
+ * @then flat()[i*stride(0) + j] == at(i,j) and rows were added in that order
+ *
+ * @covers ConstraintGroup::flat(), stride(), count()
+ */
+TEST_CASE("M1: FlatStorage::RowMajorLayout", "[ConstraintGroup][flat]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 100, "X", 3, 4);
+
+    auto cap = dsl::ConstraintFactory::add(model, "cap",
+        [&](const std::vector<int>& idx) {
+            return X(idx[0], idx[1]) <= 10.0 * idx[0] + idx[1];
+        }, 3, 4);
+    model.update();
+
+    REQUIRE(cap.count() == 12);
+    REQUIRE(cap.stride(0) == 4);
+    REQUIRE(cap.stride(1) == 1);
+
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            const GRBConstr& c = cap.at(i, j);
+            REQUIRE(c.sameAs(cap.flat()[i * 4 + j]));
+            REQUIRE(c.index() == i * 4 + j);
+            REQUIRE(c.get(GRB_DoubleAttr_RHS) == Catch::Approx(10.0 * i + j));
+        }
+    }
+}
+
+/**
+ * @test FlatStorage::TreeConstructorAndShapeChecks
+ * @brief Verifies the compatibility constructors and shape validation
+ *
+ * @covers ConstraintGroup(Node&&, int)
+ * @covers ConstraintGroup(std::vector<GRBConstr>&&, std::vector<size_t>)
+ */
+TEST_CASE("M2: FlatStorage::TreeConstructorAndShapeChecks", "[ConstraintGroup][flat]")
+{
+    GRBModel model = makeModel();
+    GRBVar x = model.addVar(0, 1, 0, GRB_CONTINUOUS);
+    GRBConstr a = model.addConstr(x <= 1);
+    GRBConstr b = model.addConstr(x >= 0);
+
+    dsl::ConstraintGroup::Node root(2);
+    root.children[0] = dsl::ConstraintGroup::Node(a);
+    root.children[1] = dsl::ConstraintGroup::Node(b);
+    dsl::ConstraintGroup fromTree(std::move(root), 1);
+
+    REQUIRE(fromTree.count() == 2);
+    REQUIRE(fromTree.at(1).sameAs(b));
+
+    REQUIRE_THROWS_AS(dsl::ConstraintGroup(std::vector<GRBConstr>{ a }, { 2 }),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(
+        dsl::ConstraintFactory::add(model, "neg",
+            [&](const std::vector<int>&) { return x <= 1; }, -1),
+        std::invalid_argument);
+}
+
+// ============================================================================
+// SECTION N: INDEXEDCONSTRAINTSET KEY LOOKUP
+// ============================================================================
+
+/**
+ * @test IndexedLookup::VariadicArraySpan
+ * @brief Verifies at()/try_get() agree across variadic, std::array and span keys
+ *
+ * @scenario A filtered 2-D constraint set is created
+ * @given lim(i,j): X(i,j) <= i + j for i != j
+ * @when Looking up every (i,j) through each key form
+ * @then Present keys resolve to the same constraint; absent keys throw or return nullptr
+ *
+ * @covers IndexedConstraintSet::at(std::span<const int>)
+ * @covers IndexedConstraintSet::at(const std::array<int, N>&)
+ * @covers IndexedConstraintSet::try_get()
+ */
+TEST_CASE("N1: IndexedLookup::VariadicArraySpan", "[IndexedConstraintSet][lookup]")
+{
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 6);
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 100, "X", 6, 6);
+
+    auto lim = dsl::ConstraintFactory::addIndexed(model, "lim",
+        (I * I) | dsl::filter([](int i, int j) { return i != j; }),
+        [&](int i, int j) { return X(i, j) <= i + j; });
+    model.update();
+
+    REQUIRE(lim.size() == 30);
+
+    const std::vector<int> buffer{ 0, 0, 0, 0 };
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j < 6; ++j) {
+            const std::array<int, 2> key{ i, j };
+            const std::span<const int> view(key);
+            if (i == j) {
+                REQUIRE(lim.try_get(i, j) == nullptr);
+                REQUIRE(lim.try_get(key) == nullptr);
+                REQUIRE(lim.try_get(view) == nullptr);
+                REQUIRE_THROWS_AS(lim.at(key), std::out_of_range);
+                REQUIRE_THROWS_AS(lim.at(view), std::out_of_range);
+                continue;
+            }
+            const GRBConstr& c = lim.at(i, j);
+            REQUIRE(c.sameAs(lim(key)));
+            REQUIRE(c.sameAs(lim.at(view)));
+            REQUIRE(lim.try_get(key) == &lim.at(i, j));
+            REQUIRE(c.get(GRB_DoubleAttr_RHS) == Catch::Approx(i + j));
+        }
+    }
+
+    // Wrong arity and sub-spans of a larger buffer
+    REQUIRE(lim.try_get(1) == nullptr);
+    REQUIRE(lim.try_get(std::array<int, 3>{ 0, 1, 2 }) == nullptr);
+    REQUIRE(lim.try_get(std::span<const int>(buffer).first(2)) == nullptr);
+    REQUIRE_THROWS_AS(lim.at(1, 2, 3), std::out_of_range);
+}
+
+/**
+ * @test IndexedLookup::DuplicateKeysResolveToFirst
+ * @brief Verifies duplicate domain entries keep the first constraint for lookup
+ *
+ * @covers IndexedConstraintSet::at()
+ */
+TEST_CASE("N2: IndexedLookup::DuplicateKeysResolveToFirst", "[IndexedConstraintSet][lookup]")
+{
+    GRBModel model = makeModel();
+    GRBVar x = model.addVar(0, 10, 0, GRB_CONTINUOUS);
+
+    dsl::IndexList dup{ 3, 3, 5 };
+    int k = 0;
+    auto set = dsl::ConstraintFactory::addIndexed(model, "dup", dup,
+        [&](int) { return x <= ++k; });
+    model.update();
+
+    REQUIRE(set.size() == 3);
+    REQUIRE(set.at(3).get(GRB_DoubleAttr_RHS) == Catch::Approx(1.0));
+    REQUIRE(set.at(std::array<int, 1>{ 5 }).get(GRB_DoubleAttr_RHS) == Catch::Approx(3.0));
+}
+
+// ============================================================================
+// SECTION O: BULK CONSTRAINT ATTRIBUTES
+// ============================================================================
+
+/**
+ * @test BulkAttributes::RhsRoundTrip
+ * @brief Verifies getAttr()/setAttr() on RHS for dense, sparse and table-held rows
+ *
+ * @scenario A 2x3 group and a filtered indexed set are created
+ * @given cap(i,j): X(i,j) <= i + j and lim(i,j) stored in a ConstraintTable
+ * @when RHS values are read, scaled and written back in bulk
+ * @then Per-row get() observes the new values in iteration order
+ *
+ * @covers dsl::getAttr(ConstraintGroup), dsl::setAttr(ConstraintGroup)
+ * @covers dsl::getAttr(IndexedConstraintSet), dsl::setAttr(ConstraintContainer)
+ */
+TEST_CASE("O1: BulkAttributes::RhsRoundTrip", "[constraints][attributes]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 100, "X", 3, 3);
+
+    auto cap = dsl::ConstraintFactory::add(model, "cap",
+        [&](const std::vector<int>& idx) {
+            return X(idx[0], idx[1]) <= idx[0] + idx[1];
+        }, 2, 3);
+    auto I = dsl::range(0, 3);
+    auto lim = dsl::ConstraintFactory::addIndexed(model, "lim",
+        (I * I) | dsl::filter([](int i, int j) { return i < j; }),
+        [&](int i, int j) { return X(i, j) <= 10.0 * i + j; });
+    model.update();
+
+    REQUIRE(cap.model() == &model);
+    REQUIRE(lim.model() == &model);
+
+    auto rhs = dsl::getAttr(cap, GRB_DoubleAttr_RHS);
+    REQUIRE(rhs == std::vector<double>{ 0, 1, 2, 1, 2, 3 });
+
+    for (double& r : rhs) {
+        r = 2.0 * r + 1.0;
+    }
+    dsl::setAttr(cap, GRB_DoubleAttr_RHS, rhs);
+    model.update();
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            REQUIRE(cap(i, j).get(GRB_DoubleAttr_RHS) == Catch::Approx(2.0 * (i + j) + 1.0));
+        }
+    }
+
+    dsl::ConstraintTable<CDom> table;
+    table.set(CDom::B, lim);
+
+    std::array<double, 3> buf{};
+    dsl::getAttr(table(CDom::B), GRB_DoubleAttr_RHS, buf);
+    REQUIRE(buf == std::array<double, 3>{ 1, 2, 12 });
+
+    const std::array<double, 3> next{ 7, 8, 9 };
+    dsl::setAttr(table(CDom::B), GRB_DoubleAttr_RHS, next);
+    model.update();
+    REQUIRE(lim.at(0, 1).get(GRB_DoubleAttr_RHS) == Catch::Approx(7.0));
+    REQUIRE(lim.at(1, 2).get(GRB_DoubleAttr_RHS) == Catch::Approx(9.0));
+}
+
+/**
+ * @test BulkAttributes::SizeChecksAndFallback
+ * @brief Verifies misaligned spans throw and hand-built groups fall back to per-row access
+ *
+ * @covers dsl::getAttr(), dsl::setAttr(), ConstraintGroup::setModel()
+ * @covers dsl::getAttr(GRBModel&, ConstraintGroup), dsl::setAttr(GRBModel&, ConstraintContainer)
+ */
+TEST_CASE("O2: BulkAttributes::SizeChecksAndFallback", "[constraints][attributes][edge]")
+{
+    GRBModel model = makeModel();
+    GRBVar x = model.addVar(0, 10, 0, GRB_CONTINUOUS);
+    GRBConstr a = model.addConstr(x <= 3);
+    GRBConstr b = model.addConstr(x <= 4);
+    model.update();
+
+    dsl::ConstraintGroup G(std::vector<GRBConstr>{ a, b }, { 2 });
+    REQUIRE(G.model() == nullptr);
+    REQUIRE(dsl::getAttr(G, GRB_DoubleAttr_RHS) == std::vector<double>{ 3, 4 });
+
+    std::vector<double> tooShort(1);
+    REQUIRE_THROWS_AS(dsl::getAttr(G, GRB_DoubleAttr_RHS, tooShort), std::invalid_argument);
+    REQUIRE_THROWS_AS(dsl::setAttr(G, GRB_DoubleAttr_RHS, tooShort), std::invalid_argument);
+
+    REQUIRE(dsl::getAttr(model, G, GRB_DoubleAttr_RHS) == std::vector<double>{ 3, 4 });
+    dsl::ConstraintContainer C(G);
+    dsl::setAttr(model, C, GRB_DoubleAttr_RHS, std::vector<double>{ 4, 5 });
+    model.update();
+    std::array<double, 2> buf{};
+    dsl::getAttr(model, C, GRB_DoubleAttr_RHS, buf);
+    REQUIRE(buf == std::array<double, 2>{ 4, 5 });
+    REQUIRE_THROWS_AS(dsl::getAttr(model, G, GRB_DoubleAttr_RHS, tooShort), std::invalid_argument);
+
+    G.setModel(model);
+    dsl::setAttr(G, GRB_DoubleAttr_RHS, std::vector<double>{ 5, 6 });
+    model.update();
+    REQUIRE(b.get(GRB_DoubleAttr_RHS) == Catch::Approx(6.0));
+
+    dsl::ConstraintContainer none;
+    REQUIRE_THROWS_AS(dsl::getAttr(none, GRB_DoubleAttr_RHS), std::runtime_error);
+    REQUIRE_THROWS_AS(dsl::setAttr(none, GRB_DoubleAttr_RHS, tooShort), std::runtime_error);
+    REQUIRE_THROWS_AS(dsl::getAttr(model, none, GRB_DoubleAttr_RHS), std::runtime_error);
+}
+
+// ============================================================================
+// SECTION P: PARALLEL CONSTRAINT GENERATION
+// ============================================================================
+
+/**
+ * @test ParallelCreation::MatchesBatched
+ * @brief Verifies addIndexedParallel yields the same rows, in the same order, as addIndexedBatched
+ *
+ * @scenario Cartesian and filtered domains, chunk size smaller than the domain
+ * @given A 4-thread pool and batch size 7
+ * @when Creating rows with both factories
+ * @then Model row order, coefficients, rhs, entry order and lookups agree
+ *
+ * @covers ConstraintFactory::addIndexedParallel()
+ */
+TEST_CASE("P1: ParallelCreation::MatchesBatched", "[constraints][parallel]")
+{
+    ConstrBatchSizeGuard guard;
+    dsl::ConstraintFactory::setBatchSize(7);
+    dsl::WorkStealingPool pool(4);
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 12);
+    auto J = dsl::range_view(0, 9);
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 12, 9);
+    auto gen = [&](int i, int j) {
+        return dsl::LinRow{ (1.0 + i) * X(i, j) - 0.5 * X(i, (j + 1) % 9), GRB_LESS_EQUAL, 0.1 * (i * 9 + j) };
+    };
+
+    auto check = [&](const auto& domain) {
+        const int before = model.get(GRB_IntAttr_NumConstrs);
+        auto batched = dsl::ConstraintFactory::addIndexedBatched(model, "b", domain, gen);
+        auto parallel = dsl::ConstraintFactory::addIndexedParallel(model, "p", domain, gen, pool);
+        model.update();
+
+        REQUIRE(parallel.size() == batched.size());
+        REQUIRE(model.get(GRB_IntAttr_NumConstrs) == before + 2 * static_cast<int>(batched.size()));
+
+        auto b = batched.begin();
+        int row = before + static_cast<int>(batched.size());
+        for (const auto& e : parallel) {
+            REQUIRE(std::ranges::equal(e.index, b->index));
+            REQUIRE(e.constr.index() == row++);
+            REQUIRE(e.constr.get(GRB_DoubleAttr_RHS) == b->constr.get(GRB_DoubleAttr_RHS));
+            const int i = e.index[0], j = e.index[1];
+            REQUIRE(model.getCoeff(e.constr, X(i, j)) == model.getCoeff(b->constr, X(i, j)));
+            REQUIRE(parallel.at(i, j).sameAs(e.constr));
+            ++b;
+        }
+    };
+
+    SECTION("Cartesian domain") { check(I * J); }
+    SECTION("Filtered domain") { check((I * J) | dsl::filter([](int i, int j) { return (i + j) % 4 != 0; })); }
+}
+
+/**
+ * @test ParallelCreation::ErrorsAndEdgeCases
+ * @brief Verifies exception propagation, empty domains and nested calls
+ *
+ * @covers ConstraintFactory::addIndexedParallel()
+ */
+TEST_CASE("P2: ParallelCreation::ErrorsAndEdgeCases", "[constraints][parallel][edge]")
+{
+    ConstrBatchSizeGuard guard;
+    dsl::ConstraintFactory::setBatchSize(3);
+    dsl::WorkStealingPool pool(3);
+
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 50);
+
+    SECTION("Generator exception reaches the caller") {
+        REQUIRE_THROWS_AS(dsl::ConstraintFactory::addIndexedParallel(model, "f", dsl::range(0, 50),
+            [&](int i) {
+                if (i == 31) throw std::runtime_error("bad row");
+                return dsl::LinRow{ 1.0 * X(i), GRB_EQUAL, 0.0 };
+            }, pool), std::runtime_error);
+    }
+
+    SECTION("Empty domain") {
+        auto rows = dsl::ConstraintFactory::addIndexedParallel(model, "e", dsl::IndexList{},
+            [&](int i) { return dsl::LinRow{ 1.0 * X(i), GRB_EQUAL, 0.0 }; }, pool);
+        model.update();
+        REQUIRE(rows.empty());
+        REQUIRE(model.get(GRB_IntAttr_NumConstrs) == 0);
+    }
+
+    SECTION("Called from inside a pool task") {
+        std::size_t made = 0;
+        pool.run(1, [&](std::size_t) {
+            made = dsl::ConstraintFactory::addIndexedParallel(model, "n", dsl::range(0, 10),
+                [&](int i) { return dsl::LinRow{ 1.0 * X(i), GRB_LESS_EQUAL, 1.0 }; }, pool).size();
+        });
+        model.update();
+        REQUIRE(made == 10);
+        REQUIRE(model.get(GRB_IntAttr_NumConstrs) == 10);
+    }
+}
+
+// ============================================================================
+// SECTION Q: INDEXEDCONSTRAINTSET STRUCTURE-OF-ARRAYS STORAGE
+// ============================================================================
+
+/**
+ * @test IndexedConstraintStorage::EntryViewsAliasFlatStorage
+ * @brief Verifies IndexedConstraintSet entries are views over flat() and packed indices
+ *
+ * @scenario Filtered 2-D constraint set built serially, batched and in parallel
+ * @given Rows c(i,j) for i < j over 0..4 x 0..4
+ * @when Walking all()[k] of each set
+ * @then Entry::constr aliases flat()[k]; indices match across the three builders
+ *
+ * @covers IndexedConstraintSet::Entry, IndexedConstraintSet::all(), IndexedConstraintSet::flat()
+ */
+TEST_CASE("Q1: IndexedConstraintStorage::EntryViewsAliasFlatStorage", "[constraints][indexed][storage]")
+{
+    static_assert(std::random_access_iterator<dsl::IndexedConstraintSet::const_iterator>);
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 5);
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 5, 5);
+    model.update();
+    auto D = (I * I) | dsl::filter([](int i, int j) { return i < j; });
+
+    auto serial = dsl::ConstraintFactory::addIndexed(model, "s", D,
+        [&](int i, int j) { return X(i, j) <= double(i + j); });
+    auto batched = dsl::ConstraintFactory::addIndexedBatched(model, "b", D,
+        [&](int i, int j) { return dsl::LinRow{ X(i, j), GRB_LESS_EQUAL, double(i + j) }; });
+    auto parallel = dsl::ConstraintFactory::addIndexedParallel(model, "p", D,
+        [&](int i, int j) { return dsl::LinRow{ X(i, j), GRB_LESS_EQUAL, double(i + j) }; });
+    model.update();
+
+    REQUIRE(serial.size() == 10);
+    for (const auto* cs : { &serial, &batched, &parallel }) {
+        const auto entries = cs->all();
+        REQUIRE(entries.size() == serial.size());
+        for (std::size_t k = 0; k < entries.size(); ++k) {
+            REQUIRE(&entries[k].constr == &cs->flat()[k]);
+            REQUIRE(std::ranges::equal(entries[k].index, serial.all()[k].index));
+            REQUIRE(&cs->at(entries[k].index) == &entries[k].constr);
+        }
+        REQUIRE(entries[1].index.data() == entries[0].index.data() + 2);
+    }
+}
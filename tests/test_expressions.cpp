@@ -22,6 +22,7 @@ TEST ORGANIZATION
 � Section H: Error scenarios and exception handling
 � Section I: Iterator properties and performance
 � Section J: Quadratic sum (quadSum) for QP objectives
+� Section K: Term-buffer expression builder (LinExprBuilder)
 
 TEST STRATEGY
 -------------
@@ -582,7 +583,7 @@ TEST_CASE("E5: VariableGroupSum::SumEqualsManualAccumulation", "[expressions][su
     model.update();
 
     GRBLinExpr manual = 0.0;
-    for (auto& e : XV.all())
+    for (const auto& e : XV.all())
         manual += e.var;
 
     GRBLinExpr expr = dsl::sum(XV);
@@ -1511,4 +1512,80 @@ TEST_CASE("J6: QuadSum::CombinedWithLinearTerms", "[expressions][quadsum][combin
     REQUIRE_NOTHROW(model.optimize());
     // Each x[i] should be 1, objective = 1 - 2 + 1 - 2 = -2
     REQUIRE(model.get(GRB_DoubleAttr_ObjVal) == Catch::Approx(-2.0));
-}
\ No newline at end of file
+}
+// ============================================================================
+// SECTION K: TERM-BUFFER EXPRESSION BUILDER (LinExprBuilder)
+// ============================================================================
+
+/**
+ * @test LinExprBuilder::MatchesLambdaSum
+ * @brief Verifies sum(builder, D, f) builds the same terms as sum(D, f)
+ *
+ * @scenario Weighted sum over a filtered 2D domain
+ * @given X(i,j) on 4x4 and weights 10*i + j for i < j
+ * @when Summing with dsl::term() into a LinExprBuilder
+ * @then Term count, order, coefficients and constant match the += version
+ *
+ * @covers dsl::sum(LinExprBuilder&, Range, Func), dsl::term()
+ */
+TEST_CASE("K1: LinExprBuilder::MatchesLambdaSum", "[expressions][builder]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 4, 4);
+    model.update();
+
+    auto I = dsl::range(0, 4);
+    auto D = (I * I) | dsl::filter([](int i, int j) { return i < j; });
+
+    GRBLinExpr reference = dsl::sum(D, [&](int i, int j) { return (10.0 * i + j) * X(i, j); });
+
+    dsl::LinExprBuilder b;
+    GRBLinExpr built = dsl::sum(b, D, [&](int i, int j) { return dsl::term(10.0 * i + j, X(i, j)); });
+
+    REQUIRE(b.size() == 6);
+    REQUIRE(built.size() == reference.size());
+    for (unsigned int k = 0; k < reference.size(); ++k) {
+        REQUIRE(built.getVar(k).sameAs(reference.getVar(k)));
+        REQUIRE(built.getCoeff(k) == Catch::Approx(reference.getCoeff(k)));
+    }
+    REQUIRE(built.getConstant() == Catch::Approx(0.0));
+}
+
+/**
+ * @test LinExprBuilder::MixedTermsAndReuse
+ * @brief Verifies GRBVar/double/GRBLinExpr inputs and that reuse keeps capacity
+ *
+ * @covers LinExprBuilder::add(), clear(), appendTo(), build()
+ */
+TEST_CASE("K2: LinExprBuilder::MixedTermsAndReuse", "[expressions][builder]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 3);
+    model.update();
+
+    dsl::LinExprBuilder b(8);
+    b += X(0);
+    b += 2.5;
+    b += dsl::term(-3.0, X(1));
+    b += 4.0 * X(2) + 1.0;
+
+    REQUIRE(b.size() == 3);
+    REQUIRE(b.constant() == Catch::Approx(3.5));
+    REQUIRE(b.coeffs()[2] == Catch::Approx(4.0));
+
+    GRBLinExpr e = 7.0 * X(0);
+    b.appendTo(e);
+    REQUIRE(e.size() == 4);
+    REQUIRE(e.getConstant() == Catch::Approx(3.5));
+    REQUIRE(e.getVar(3).sameAs(X(2)));
+
+    const double* before = b.coeffs().data();
+    b.clear();
+    REQUIRE(b.empty());
+    REQUIRE(b.constant() == 0.0);
+
+    GRBLinExpr second = dsl::sum(b, dsl::range(0, 3), [&](int i) { return X(i); });
+    REQUIRE(second.size() == 3);
+    REQUIRE(b.coeffs().data() == before);   // same buffer reused
+    REQUIRE(dsl::sum(b, dsl::IndexList{}, [&](int i) { return X(i); }).size() == 0);
+}
@@ -15,12 +15,19 @@ TEST ORGANIZATION
  Section A: IndexList construction and basic operations
  Section B: Set operations (union, intersection, difference, symmetric)
  Section C: RangeView construction and iteration
- Section D: Cartesian product basics and iteration order
+ Section D: Cartesian product basics, iteration order, and random access
  Section E: Filtered views (member .filter() and pipe syntax)
  Section F: Printing utilities
  Section G: Integration and complex scenarios
  Section H: Edge cases and error conditions
  Section I: Iterator properties and performance
+ Section J: Membership index and large set operations
+ Section K: IntervalSet run-length domains
+ Section L: Relation<N> sparse tuple domains (CSR)
+ Section M: Filter pushdown on Cartesian products
+ Section N: Materialized (TupleList) and cached domains
+ Section O: Block-wise (batch) filtering
+ Section P: Group-by index over tuple domains
 
 TEST STRATEGY
 -------------
@@ -46,7 +53,14 @@ DEPENDENCIES
 #include <set>
 #include <sstream>
 #include <algorithm>
+#include <climits>
 #include <numeric>
+#include <limits>
+#include <ranges>
+#include <thread>
+#include <atomic>
+#include <span>
+#include <cstdint>
 
 using namespace dsl;
 
@@ -282,8 +296,8 @@ TEST_CASE("B1: SetUnion::BasicAndOrderPreservation", "[IndexList][set][union]")
         auto U2 = B + A;
 
         // Same elements but different order
-        std::sort(U1.begin(), U1.end());
-        std::sort(U2.begin(), U2.end());
+        std::ranges::sort(U1.writable());
+        std::ranges::sort(U2.writable());
         REQUIRE(std::equal(U1.begin(), U1.end(), U2.begin()));
     }
 }
@@ -1031,6 +1045,88 @@ TEST_CASE("D3: CartesianMixed::MixedTypes", "[Cartesian][mixed]") {
     }
 }
 
+/**
+ * @test CartesianRandomAccess::RankUnrank
+ * @brief Verifies linear-rank addressing and random-access iteration
+ *
+ * @scenario 3-D product of IndexList, RangeView and IndexList
+ * @given A product with uneven dimension sizes
+ * @when Using rank/unrank/operator[] and iterator arithmetic
+ * @then Every access agrees with sequential iteration order
+ *
+ * @covers Cartesian::rank, Cartesian::unrank, Cartesian::operator[],
+ *         Cartesian::iterator arithmetic
+ */
+TEST_CASE("D4: CartesianRandomAccess::RankUnrank", "[Cartesian][random_access]") {
+    IndexList A{ 5, 1, 9 };
+    auto R = range_view(0, 8, 2);        // 0, 2, 4, 6
+    IndexList C{ 100, 200 };
+    auto P = A * R * C;                  // 3 * 4 * 2 = 24
+
+    static_assert(std::ranges::random_access_range<decltype(P)>);
+    static_assert(std::ranges::sized_range<decltype(P)>);
+
+    std::vector<std::tuple<int, int, int>> seq(P.begin(), P.end());
+    REQUIRE(seq.size() == 24);
+
+    SECTION("operator[] and unrank/rank round-trip") {
+        for (std::size_t k = 0; k < P.size(); ++k) {
+            REQUIRE(P[k] == seq[k]);
+            auto pos = P.unrank(k);
+            REQUIRE(P.rank(pos) == k);
+        }
+        REQUIRE(P.unrank(13) == std::array<std::size_t, 3>{ 1, 2, 1 });
+        REQUIRE(P[13] == std::tuple{ 1, 4, 200 });
+    }
+
+    SECTION("Iterator arithmetic and distance") {
+        auto b = P.begin();
+        auto e = P.end();
+
+        REQUIRE(e - b == 24);
+        REQUIRE(std::ranges::distance(P) == 24);
+        REQUIRE(*(b + 7) == seq[7]);
+        REQUIRE(b[23] == seq[23]);
+        REQUIRE(*(e - 1) == seq[23]);
+        REQUIRE((b + 24) == e);
+        REQUIRE(b < e);
+
+        auto it = b + 10;
+        it -= 3;
+        REQUIRE(*it == seq[7]);
+        REQUIRE(it.rank() == 7);
+    }
+
+    SECTION("Decrement walks backwards across dimension borders") {
+        std::vector<std::tuple<int, int, int>> rev;
+        for (auto it = P.end(); it != P.begin();) {
+            --it;
+            rev.push_back(*it);
+        }
+        std::reverse(rev.begin(), rev.end());
+        REQUIRE(rev == seq);
+    }
+
+    SECTION("Equal slices cover the product exactly once") {
+        const std::size_t slices = 5;
+        std::vector<std::tuple<int, int, int>> joined;
+        for (std::size_t s = 0; s < slices; ++s) {
+            auto first = P.begin() + static_cast<std::ptrdiff_t>(s * P.size() / slices);
+            auto last = P.begin() + static_cast<std::ptrdiff_t>((s + 1) * P.size() / slices);
+            for (auto it = first; it != last; ++it)
+                joined.push_back(*it);
+        }
+        REQUIRE(joined == seq);
+    }
+
+    SECTION("Empty dimension") {
+        IndexList E;
+        auto Q = A * E;
+        REQUIRE(Q.begin() == Q.end());
+        REQUIRE(Q.end() - Q.begin() == 0);
+    }
+}
+
 // ============================================================================
 // SECTION E: FILTERED VIEWS
 // ============================================================================
@@ -1793,7 +1889,8 @@ TEST_CASE("G1: Integration::ComplexScenarios", "[integration]") {
 
         // Create index set for items
         IndexList items(weights.size());
-        std::iota(items.begin(), items.end(), 0);  // {0, 1, 2, 3}
+        auto slots = items.writable();
+        std::iota(slots.begin(), slots.end(), 0);  // {0, 1, 2, 3}
 
         // All possible pairs of items
         auto all_pairs = items * items;
@@ -2181,4 +2278,872 @@ TEST_CASE("I2: PerformanceSanity::LazyEvaluation", "[performance]") {
         // Memory usage should be roughly constant + predicate
         // (not proportional to 1000)
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// SECTION J: MEMBERSHIP INDEX AND LARGE SET OPERATIONS
+// ============================================================================
+
+/**
+ * @test IndexListMembership::LazyIndex
+ * @brief Verifies contains() on lists above the indexing threshold
+ *
+ * @scenario Dense and sparse value spans, mutation after indexing, copies
+ * @given IndexLists larger than INDEXED_THRESHOLD
+ * @when Querying membership before and after push_back / writable() / iteration / copy
+ * @then Results match a linear scan in both bitset and hash layouts
+ *
+ * @covers IndexList::contains, IndexList::writable, detail::IndexMembership, detail::LazyMembership
+ */
+TEST_CASE("J1: IndexListMembership::LazyIndex", "[IndexList][membership]") {
+
+    SECTION("Dense span uses bitset layout") {
+        std::vector<int> v;
+        for (int i = -500; i < 500; i += 3) v.push_back(i);
+        IndexList I(v);
+
+        REQUIRE(detail::IndexMembership::of(v).dense());
+        for (int x = -600; x < 600; ++x) {
+            bool expected = std::find(v.begin(), v.end(), x) != v.end();
+            REQUIRE(I.contains(x) == expected);
+        }
+    }
+
+    SECTION("Sparse span uses hash layout") {
+        std::vector<int> v;
+        for (int i = 0; i < 200; ++i) v.push_back(i * 1000003 - 7000000);
+        v.push_back(std::numeric_limits<int>::min());
+        v.push_back(std::numeric_limits<int>::max());
+        IndexList I(v);
+
+        REQUIRE_FALSE(detail::IndexMembership::of(v).dense());
+        for (int x : v) {
+            REQUIRE(I.contains(x));
+            if (x != std::numeric_limits<int>::max())
+                REQUIRE_FALSE(I.contains(x + 1));
+        }
+        REQUIRE_FALSE(I.contains(0));
+    }
+
+    SECTION("push_back after indexing is visible") {
+        std::vector<int> v(100);
+        std::iota(v.begin(), v.end(), 0);
+        IndexList I(v);
+
+        REQUIRE_FALSE(I.contains(1000));
+        I.push_back(1000);
+        REQUIRE(I.contains(1000));
+    }
+
+    SECTION("Mutation through writable() is visible") {
+        std::vector<int> v(100);
+        std::iota(v.begin(), v.end(), 0);
+        IndexList I(v);
+
+        static_assert(std::is_same_v<decltype(*I.begin()), const int&>,
+                      "IndexList iteration must be read-only");
+        REQUIRE(I.contains(5));
+        I.writable()[0] = 5000;
+        REQUIRE(I.contains(5000));
+        REQUIRE_FALSE(I.contains(0));
+    }
+
+    SECTION("Set operators see in-place writes to an indexed operand") {
+        std::vector<int> v(100);
+        std::iota(v.begin(), v.end(), 0);
+        IndexList A(v), B(v);
+
+        REQUIRE((A & B).size() == 100);           // builds B's index
+        auto w = B.writable();
+        std::transform(w.begin(), w.end(), w.begin(), [](int x) { return x + 50; });
+
+        REQUIRE((A - B).raw() == std::vector<int>(v.begin(), v.begin() + 50));
+        REQUIRE((A & B).size() == 50);
+        REQUIRE(B.contains(149));
+        REQUIRE_FALSE(B.contains(0));
+    }
+
+    SECTION("Iterating a queried list keeps the index valid") {
+        std::vector<int> v(100);
+        std::iota(v.begin(), v.end(), 0);
+        IndexList I(v);
+
+        REQUIRE(I.contains(5));
+        long long total = 0;
+        for (int x : I) {
+            total += x;
+        }
+        REQUIRE(total == 4950);
+        REQUIRE(I.contains(99));
+        REQUIRE_FALSE(I.contains(100));
+
+        I = IndexList{ 7 };
+        REQUIRE(I.contains(7));
+        REQUIRE_FALSE(I.contains(5));
+    }
+
+    SECTION("Copies answer independently") {
+        std::vector<int> v(100);
+        std::iota(v.begin(), v.end(), 0);
+        IndexList I(v);
+        REQUIRE(I.contains(50));
+
+        IndexList C = I;
+        C.push_back(-1);
+        REQUIRE(C.contains(-1));
+        REQUIRE_FALSE(I.contains(-1));
+        REQUIRE(C.contains(50));
+    }
+}
+
+/**
+ * @test IndexListSetOps::LargeOperands
+ * @brief Verifies set operators on large lists keep order semantics
+ *
+ * @scenario 50k-element operands with overlap and duplicates
+ * @given Two IndexLists with partially overlapping values
+ * @when Applying +, &, -, ^
+ * @then Output matches the reference order-preserving definitions
+ *
+ * @covers operator+, operator&, operator-, operator^ (IndexList)
+ */
+TEST_CASE("J2: IndexListSetOps::LargeOperands", "[IndexList][set_ops][membership]") {
+    std::vector<int> a, b;
+    for (int i = 0; i < 50000; ++i) a.push_back(static_cast<int>((i * 7919LL) % 100000));
+    for (int i = 0; i < 50000; ++i) b.push_back(50000 + static_cast<int>((i * 104729LL) % 100000));
+    a.push_back(a.front());          // duplicate inside A is preserved
+    b.push_back(b.front());          // duplicate inside B is emitted once by union
+
+    IndexList A(a), B(b);
+    std::set<int> sa(a.begin(), a.end()), sb(b.begin(), b.end());
+
+    std::vector<int> expUnion = a;
+    std::set<int> seen(a.begin(), a.end());
+    for (int x : b) if (seen.insert(x).second) expUnion.push_back(x);
+
+    std::vector<int> expInter, expDiff, expSym;
+    for (int x : a) if (sb.count(x)) expInter.push_back(x);
+    for (int x : a) if (!sb.count(x)) expDiff.push_back(x);
+    expSym = expDiff;
+    std::set<int> symSeen(expDiff.begin(), expDiff.end());
+    for (int x : b) if (!sa.count(x) && symSeen.insert(x).second) expSym.push_back(x);
+
+    REQUIRE((A + B).raw() == expUnion);
+    REQUIRE((A & B).raw() == expInter);
+    REQUIRE((A - B).raw() == expDiff);
+    REQUIRE((A ^ B).raw() == expSym);
+}
+
+// ============================================================================
+// SECTION K: INTERVALSET RUN-LENGTH DOMAINS
+// ============================================================================
+
+/**
+ * @test IntervalSet::ConstructionAndAccess
+ * @brief Verifies run normalization, membership, and random access
+ *
+ * @scenario Overlapping/unsorted runs, compression from values, huge horizons
+ * @given IntervalSets built from runs and from value lists
+ * @when Querying size, runs, contains, operator[], and iterating
+ * @then Runs are merged and all accessors agree with the expanded set
+ *
+ * @covers IntervalSet construction, contains, operator[], iterator, add
+ */
+TEST_CASE("K1: IntervalSet::ConstructionAndAccess", "[IntervalSet]") {
+
+    SECTION("Runs are sorted, merged, and empty runs dropped") {
+        IntervalSet S{ {10, 15}, {0, 3}, {2, 5}, {5, 6}, {8, 8} };
+
+        REQUIRE(S.run_count() == 2);
+        REQUIRE(S.runs()[0] == std::pair{ 0, 6 });
+        REQUIRE(S.runs()[1] == std::pair{ 10, 15 });
+        REQUIRE(S.size() == 11);
+        REQUIRE_FALSE(S.empty());
+        REQUIRE(IntervalSet{}.empty());
+    }
+
+    SECTION("Iteration, operator[] and contains agree") {
+        IntervalSet S{ {-3, 0}, {4, 7}, {20, 22} };
+        std::vector<int> expected{ -3, -2, -1, 4, 5, 6, 20, 21 };
+
+        std::vector<int> seen(S.begin(), S.end());
+        REQUIRE(seen == expected);
+        for (std::size_t i = 0; i < expected.size(); ++i)
+            REQUIRE(S[i] == expected[i]);
+        for (int x = -5; x < 25; ++x) {
+            bool in = std::find(expected.begin(), expected.end(), x) != expected.end();
+            REQUIRE(S.contains(x) == in);
+        }
+        REQUIRE(S.to_index_list().raw() == expected);
+    }
+
+    SECTION("from_values compresses consecutive integers") {
+        auto S = IntervalSet::from_values(std::vector<int>{ 7, 1, 2, 3, 3, 8, 12 });
+
+        REQUIRE(S.run_count() == 3);
+        REQUIRE(S.runs()[0] == std::pair{ 1, 4 });
+        REQUIRE(S.runs()[1] == std::pair{ 7, 9 });
+        REQUIRE(S.runs()[2] == std::pair{ 12, 13 });
+    }
+
+    SECTION("add merges with neighbouring runs") {
+        IntervalSet S{ {0, 2}, {5, 7} };
+        S.add(2, 5);
+
+        REQUIRE(S.run_count() == 1);
+        REQUIRE(S.size() == 7);
+    }
+
+    SECTION("Large horizons stay run-sized") {
+        IntervalSet H{ {0, 10'000'000} };
+
+        REQUIRE(H.size() == 10'000'000);
+        REQUIRE(H.run_count() == 1);
+        REQUIRE(H[9'999'999] == 9'999'999);
+        REQUIRE(H.contains(5'000'000));
+        REQUIRE_FALSE(H.contains(10'000'000));
+    }
+}
+
+/**
+ * @test IntervalSet::SetOperationsAndIntegration
+ * @brief Verifies run-based set algebra, Cartesian, filter, and printing
+ *
+ * @scenario Overlapping run lists combined with +, &, -, ^
+ * @given Two IntervalSets with partial overlap
+ * @when Applying set operators and composing with other domains
+ * @then Results match element-wise std::set references
+ *
+ * @covers operator+, operator&, operator-, operator^ (IntervalSet),
+ *         operator* with IntervalSet, IntervalSet::filter, operator<<
+ */
+TEST_CASE("K2: IntervalSet::SetOperationsAndIntegration", "[IntervalSet][set_ops]") {
+    IntervalSet A{ {0, 10}, {20, 30}, {40, 45} };
+    IntervalSet B{ {5, 25}, {28, 42}, {50, 60} };
+
+    auto expand = [](const IntervalSet& S) { return std::vector<int>(S.begin(), S.end()); };
+    std::set<int> sa(A.begin(), A.end()), sb(B.begin(), B.end());
+
+    SECTION("Operators match element-wise references") {
+        std::vector<int> u, i, d, x;
+        std::set_union(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(u));
+        std::set_intersection(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(i));
+        std::set_difference(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(d));
+        std::set_symmetric_difference(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(x));
+
+        REQUIRE(expand(A + B) == u);
+        REQUIRE(expand(A & B) == i);
+        REQUIRE(expand(A - B) == d);
+        REQUIRE(expand(A ^ B) == x);
+        REQUIRE((A + B).run_count() == 2);   // [0,45) and [50,60)
+    }
+
+    SECTION("A run of B spanning several runs of A") {
+        IntervalSet C{ {0, 2}, {4, 6}, {8, 10} };
+        IntervalSet D{ {1, 9} };
+
+        REQUIRE(expand(C - D) == std::vector<int>{ 0, 9 });
+        REQUIRE(expand(C & D) == std::vector<int>{ 1, 4, 5, 8 });
+    }
+
+    SECTION("Cartesian product and filter") {
+        IntervalSet T{ {0, 2}, {5, 6} };
+        IndexList K{ 7, 8 };
+
+        std::vector<std::pair<int, int>> pairs;
+        for (auto [t, k] : T * K)
+            pairs.emplace_back(t, k);
+        REQUIRE(pairs == std::vector<std::pair<int, int>>{
+            {0, 7}, {0, 8}, {1, 7}, {1, 8}, {5, 7}, {5, 8} });
+        REQUIRE((T * range_view(0, 3) * K).size() == 18);
+
+        std::vector<int> odd;
+        for (int t : T.filter([](int t) { return t % 2 == 1; }))
+            odd.push_back(t);
+        REQUIRE(odd == std::vector<int>{ 1, 5 });
+
+        std::vector<int> piped;
+        for (int t : T | dsl::filter([](int t) { return t > 0; }))
+            piped.push_back(t);
+        REQUIRE(piped == std::vector<int>{ 1, 5 });
+    }
+
+    SECTION("Printing shows runs") {
+        std::ostringstream os;
+        os << intervals({ {0, 3}, {5, 6} });
+        REQUIRE(os.str() == "intervals{[0, 3), [5, 6)}");
+    }
+}
+
+// ============================================================================
+// SECTION L: RELATION<N> SPARSE TUPLE DOMAINS
+// ============================================================================
+
+/**
+ * @test Relation::CsrAdjacency
+ * @brief Verifies construction, ordering, out()/in() slices and membership
+ *
+ * @scenario Arc set of a small directed graph, given unsorted with duplicates
+ * @given A Relation<2> built from tuples and from a filtered product
+ * @when Querying size, iteration order, adjacency and contains()
+ * @then Results match the filtered product evaluated directly
+ *
+ * @covers Relation<2>, Relation::from, out, in, contains, operator[]
+ */
+TEST_CASE("L1: Relation::CsrAdjacency", "[Relation]") {
+    SECTION("Tuples are sorted and deduplicated") {
+        Relation<2> A{ {2, 0}, {0, 1}, {0, 3}, {2, 0}, {1, 2}, {0, 2} };
+
+        REQUIRE(A.size() == 5);
+        std::vector<std::tuple<int, int>> seen(A.begin(), A.end());
+        REQUIRE(seen == std::vector<std::tuple<int, int>>{ {0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 0} });
+        REQUIRE(A[3] == std::tuple{ 1, 2 });
+
+        REQUIRE(std::vector<int>(A.out(0).begin(), A.out(0).end()) == std::vector<int>{ 1, 2, 3 });
+        REQUIRE(A.out(3).empty());
+        REQUIRE(A.out(-5).empty());
+        REQUIRE(std::vector<int>(A.in(2).begin(), A.in(2).end()) == std::vector<int>{ 0, 1 });
+        REQUIRE(A.in(7).empty());
+        REQUIRE(A.outDegree(0) == 3);
+        REQUIRE(A.inDegree(0) == 1);
+
+        REQUIRE(A.contains(1, 2));
+        REQUIRE_FALSE(A.contains(2, 1));
+        REQUIRE_FALSE(A.contains(9, 9));
+    }
+
+    SECTION("from() materializes a filtered product") {
+        auto V = range(0, 30);
+        auto pred = [](int i, int j) { return i != j && (i * 7 + j * 3) % 5 == 0; };
+        auto F = (V * V) | dsl::filter(pred);
+        auto A = Relation<2>::from(F);
+
+        std::vector<std::tuple<int, int>> expected(F.begin(), F.end());
+        std::vector<std::tuple<int, int>> got(A.begin(), A.end());
+        REQUIRE(got == expected);
+
+        for (int i = 0; i < 30; ++i) {
+            std::size_t outs = 0, ins = 0;
+            for (int j = 0; j < 30; ++j) {
+                REQUIRE(A.contains(i, j) == pred(i, j));
+                outs += pred(i, j);
+                ins += pred(j, i);
+            }
+            REQUIRE(A.outDegree(i) == outs);
+            REQUIRE(A.inDegree(i) == ins);
+            for (int j : A.in(i)) REQUIRE(pred(j, i));
+        }
+    }
+
+    SECTION("Empty relation") {
+        Relation<2> E;
+        REQUIRE(E.empty());
+        REQUIRE(E.begin() == E.end());
+        REQUIRE(E.out(0).empty());
+        REQUIRE(E.in(0).empty());
+        REQUIRE_FALSE(E.contains(0, 0));
+    }
+}
+
+/**
+ * @test Relation::HigherArityAndIntegration
+ * @brief Verifies N = 3 relations and use as a domain for filter/printing
+ *
+ * @covers Relation<3>, outRange, column, Relation::filter, operator<<
+ */
+TEST_CASE("L2: Relation::HigherArityAndIntegration", "[Relation]") {
+    Relation<3> R{ {1, 5, 2}, {0, 4, 4}, {1, 2, 9}, {1, 5, 1} };
+
+    static_assert(std::ranges::random_access_range<Relation<3>>);
+    REQUIRE(R.size() == 4);
+    REQUIRE(R[0] == std::tuple{ 0, 4, 4 });
+    REQUIRE(R[1] == std::tuple{ 1, 2, 9 });
+
+    auto [lo, hi] = R.outRange(1);
+    REQUIRE(hi - lo == 3);
+    REQUIRE(R.column(2)[lo] == 9);
+    REQUIRE(R.contains(1, 5, 1));
+    REQUIRE_FALSE(R.contains(1, 5, 3));
+
+    std::vector<int> sums;
+    for (auto [a, b, c] : R.filter([](int a, int, int) { return a == 1; }))
+        sums.push_back(a + b + c);
+    REQUIRE(sums == std::vector<int>{ 12, 7, 8 });
+
+    std::ostringstream os;
+    os << Relation<2>{ {0, 1}, {1, 2} };
+    REQUIRE(os.str() == "relation{(0,1), (1,2)}");
+}
+
+/**
+ * @test Relation::SparseNodeIds
+ * @brief Verifies relations over widely spread ids index only distinct keys
+ *
+ * @scenario Node ids near both ends of the int range
+ * @given Arcs {0,1}, {2e9,1}, {2e9,-2e9}, {-2e9,0}
+ * @when Querying out(), in(), degrees and contains()
+ * @then Same answers as a compact relation, without a span-sized offset array
+ *
+ * @covers Relation::out, Relation::in, Relation::contains, detail::KeyOffsets
+ */
+TEST_CASE("L3: Relation::SparseNodeIds", "[Relation]") {
+    constexpr int big = 2'000'000'000;
+    Relation<2> A{ {0, 1}, {big, 1}, {big, -big}, {-big, 0} };
+
+    REQUIRE(A.size() == 4);
+    REQUIRE(std::vector<int>(A.out(big).begin(), A.out(big).end()) == std::vector<int>{ -big, 1 });
+    REQUIRE(A.outDegree(-big) == 1);
+    REQUIRE(A.out(1).empty());
+    REQUIRE(std::vector<int>(A.in(1).begin(), A.in(1).end()) == std::vector<int>{ 0, big });
+    REQUIRE(A.inDegree(-big) == 1);
+    REQUIRE(A.in(big).empty());
+    REQUIRE(A.contains(-big, 0));
+    REQUIRE_FALSE(A.contains(0, big));
+
+    detail::KeyOffsets sparse(std::vector<int>{ 0, big, big });
+    REQUIRE_FALSE(sparse.dense());
+    REQUIRE(sparse.slots() == 2);
+    REQUIRE(sparse.block(big) == std::pair<std::size_t, std::size_t>{ 1, 3 });
+    REQUIRE(sparse.slot(1) == detail::KeyOffsets::npos);
+
+    detail::KeyOffsets compact(std::vector<int>{ 4, 2, 4 });
+    REQUIRE(compact.dense());
+    REQUIRE(compact.slots() == 3);
+    REQUIRE(compact.block(4) == std::pair<std::size_t, std::size_t>{ 1, 3 });
+    REQUIRE(compact.count(1) == 0);
+}
+
+// ============================================================================
+// SECTION M: FILTER PUSHDOWN ON CARTESIAN PRODUCTS
+// ============================================================================
+
+/**
+ * @test FilterPushdown::MatchesUnfusedFilter
+ * @brief Verifies pushed-down filters yield the same tuples as Filtered
+ *
+ * @scenario Sparse activation masks over a 3-D product
+ * @given Predicates on i, on (i, j) and on (i, j, k)
+ * @when Filtering via filter_on<D>, via arity detection and via full tuples
+ * @then All forms yield identical tuples in lexicographic order, and prefix
+ *       predicates run once per prefix rather than once per tuple
+ *
+ * @covers filter_on, PushdownFiltered, Cartesian::filter, operator|
+ */
+TEST_CASE("M1: FilterPushdown::MatchesUnfusedFilter", "[Filtered][Pushdown]") {
+    IndexList I = range(0, 20);
+    IndexList J = range(0, 15);
+    IndexList K = range(0, 10);
+
+    auto openI = [](int i) { return i % 4 == 1; };
+    auto linkIJ = [](int i, int j) { return (i + j) % 3 == 0; };
+    auto capIJK = [](int i, int j, int k) { return (i * j + k) % 2 == 0; };
+
+    std::vector<std::tuple<int, int, int>> expected;
+    for (auto [i, j, k] : (I * J * K).filter([&](int i, int j, int k) {
+             return openI(i) && linkIJ(i, j) && capIJK(i, j, k);
+         }))
+        expected.emplace_back(i, j, k);
+    REQUIRE_FALSE(expected.empty());
+
+    SECTION("filter_on<D> form") {
+        std::size_t iCalls = 0;
+        auto F = (I * J * K) | dsl::filter(
+            filter_on<0>([&](int i) { ++iCalls; return openI(i); }),
+            filter_on<1>(linkIJ),
+            capIJK);
+        static_assert(detail::wants_pushdown_v<3, decltype(filter_on<0>(openI))>);
+        std::vector<std::tuple<int, int, int>> got;
+        for (auto t : F) got.push_back(t);   // single pass
+        REQUIRE(got == expected);
+        REQUIRE(iCalls == 20);
+    }
+
+    SECTION("Arity detection") {
+        std::size_t ijCalls = 0;
+        auto F = (I * J * K).filter(
+            openI,
+            [&](int i, int j) { ++ijCalls; return linkIJ(i, j); },
+            capIJK);
+        std::vector<std::tuple<int, int, int>> got;
+        for (auto t : F) got.push_back(t);
+        REQUIRE(got == expected);
+        REQUIRE(ijCalls == 5 * 15);   // only the 5 open i reach dimension 1
+    }
+
+    SECTION("filter_on predicate still works in a plain Filtered view") {
+        auto F = I | dsl::filter(filter_on<0>(openI));
+        std::vector<int> got(F.begin(), F.end());
+        REQUIRE(got == std::vector<int>{ 1, 5, 9, 13, 17 });
+    }
+}
+
+/**
+ * @test FilterPushdown::EdgeCases
+ * @brief Verifies empty blocks, empty results and full-arity behaviour
+ *
+ * @covers PushdownFiltered::iterator, detail::wants_pushdown_v
+ */
+TEST_CASE("M2: FilterPushdown::EdgeCases", "[Filtered][Pushdown]") {
+    IndexList I{ 3, 1, 2 };
+    RangeView R = range_view(0, 4);
+
+    SECTION("Nothing passes the prefix") {
+        auto F = (I * R).filter([](int) { return false; });
+        REQUIRE(F.begin() == F.end());
+    }
+
+    SECTION("Inner dimension rejects everything for some prefixes") {
+        auto F = (I * R) | dsl::filter([](int i, int j) { return j < i - 1; });
+        std::vector<std::tuple<int, int>> got(F.begin(), F.end());
+        REQUIRE(got == std::vector<std::tuple<int, int>>{ {3, 0}, {3, 1}, {2, 0} });
+
+        auto G = (I * R) | dsl::filter(filter_on<0>([](int i) { return i != 1; }),
+                                      [](int i, int j) { return j < i - 1; });
+        std::vector<std::tuple<int, int>> got2(G.begin(), G.end());
+        REQUIRE(got2 == got);
+    }
+
+    SECTION("Empty dimension") {
+        IndexList E;
+        auto F = (I * E * R).filter(filter_on<0>([](int) { return true; }));
+        REQUIRE(F.begin() == F.end());
+    }
+
+    SECTION("Full-arity predicates keep the unfused view") {
+        auto diag = [](int i, int j) { return i == j; };
+        static_assert(!detail::wants_pushdown_v<2, decltype(diag)>);
+        auto F = (I * R).filter(diag);
+        std::vector<std::tuple<int, int>> got(F.begin(), F.end());
+        REQUIRE(got == std::vector<std::tuple<int, int>>{ {3, 3}, {1, 1}, {2, 2} });
+    }
+}
+
+// ============================================================================
+// SECTION N: MATERIALIZED AND CACHED DOMAINS
+// ============================================================================
+
+/**
+ * @test Materialize::FilteredToCompactStore
+ * @brief Verifies materialize() returns an order-preserving compact store
+ *
+ * @scenario Filtered scalar and tuple domains over unsorted index lists
+ * @given A filtered IndexList and a filtered 3-D product
+ * @when Calling materialize()
+ * @then The store yields exactly the filtered elements in iteration order,
+ *       column-wise for tuples, and no predicate runs on later passes
+ *
+ * @covers Filtered::materialize, PushdownFiltered::materialize, TupleList
+ */
+TEST_CASE("N1: Materialize::FilteredToCompactStore", "[TupleList][Cached]") {
+    IndexList I{ 5, 2, 8, 1 };
+    IndexList J{ 3, 0, 4 };
+
+    SECTION("Scalar domain becomes an IndexList") {
+        auto L = I.filter([](int x) { return x > 1; }).materialize();
+        static_assert(std::is_same_v<decltype(L), IndexList>);
+        REQUIRE(std::vector<int>(L.begin(), L.end()) == std::vector<int>{ 5, 2, 8 });
+    }
+
+    SECTION("Tuple domain becomes a TupleList<N>") {
+        std::size_t calls = 0;
+        auto R = range_view(0, 2);
+        auto F = (I * J * R) | dsl::filter([&](int i, int j, int k) {
+            ++calls;
+            return (i + j + k) % 2 == 0;
+        });
+        auto T = F.materialize();
+        static_assert(std::is_same_v<decltype(T), TupleList<3>>);
+        static_assert(std::ranges::random_access_range<TupleList<3>>);
+        REQUIRE(calls == 24);
+
+        std::vector<std::tuple<int, int, int>> expected;
+        for (auto t : F) expected.push_back(t);
+        calls = 0;
+        std::vector<std::tuple<int, int, int>> got(T.begin(), T.end());
+        REQUIRE(calls == 0);
+        REQUIRE(got == expected);
+        REQUIRE(T.size() == expected.size());
+        for (std::size_t k = 0; k < T.size(); ++k)
+            REQUIRE(T.column(1)[k] == std::get<1>(expected[k]));
+    }
+
+    SECTION("Pushed-down filter materializes too") {
+        auto T = (I * J).filter(filter_on<0>([](int i) { return i != 2; })).materialize();
+        REQUIRE(T.size() == 9);
+        REQUIRE(T[0] == std::tuple{ 5, 3 });
+        REQUIRE(T[3] == std::tuple{ 8, 3 });
+    }
+
+    SECTION("TupleList keeps order and duplicates") {
+        TupleList<2> T{ {2, 1}, {0, 0}, {2, 1} };
+        REQUIRE(T.size() == 3);
+        REQUIRE(T[2] == std::tuple{ 2, 1 });
+        auto F = T.filter([](int a, int) { return a == 2; });
+        REQUIRE(std::distance(F.begin(), F.end()) == 2);
+
+        std::ostringstream os;
+        os << T;
+        REQUIRE(os.str() == "tuples{(2,1), (0,0), (2,1)}");
+    }
+}
+
+/**
+ * @test Cached::EvaluatesOnceAndComposes
+ * @brief Verifies cached() defers evaluation, shares the store across copies
+ *        and composes with Cartesian operator*
+ *
+ * @covers cached, Cached::materialize, Cached::materialized,
+ *         operator*(Cached, IndexList), operator*(Cartesian, Cached)
+ */
+TEST_CASE("N2: Cached::EvaluatesOnceAndComposes", "[Cached]") {
+    IndexList V = range(0, 12);
+    std::size_t calls = 0;
+    auto allowed = [&](int i, int j) { ++calls; return i != j && (i + j) % 3 != 0; };
+
+    SECTION("Tuple domain reused across passes and copies") {
+        auto A = cached((V * V) | dsl::filter(allowed));
+        REQUIRE_FALSE(A.materialized());
+        REQUIRE(calls == 0);
+
+        std::size_t n1 = 0;
+        for (auto [i, j] : A) { (void)i; (void)j; ++n1; }
+        REQUIRE(A.materialized());
+        REQUIRE(calls == 144);
+
+        auto copy = A;
+        std::size_t n2 = 0;
+        for (auto [i, j] : copy) { REQUIRE(i != j); ++n2; }
+        auto sub = A.filter([](int i, int) { return i < 3; });
+        for (auto t : sub) (void)t;
+        REQUIRE(calls == 144);
+        REQUIRE(n1 == n2);
+        REQUIRE(A.size() == n1);
+        REQUIRE(&A.materialize() == &copy.materialize());
+    }
+
+    SECTION("Scalar domain as a Cartesian factor") {
+        std::size_t oddCalls = 0;
+        auto C = cached(V | dsl::filter([&](int x) { ++oddCalls; return x % 2 == 1; }));
+        IndexList K{ 7, 9 };
+
+        auto P = C * K;
+        auto Q = (K * C) * C;
+        REQUIRE(P.size() == 12);
+        REQUIRE(Q.size() == 72);
+        REQUIRE(*P.begin() == std::tuple{ 1, 7 });
+        REQUIRE(Q[71] == std::tuple{ 9, 11, 11 });
+        REQUIRE(oddCalls == 12);
+
+        std::ostringstream os;
+        os << C;
+        REQUIRE(os.str() == "{1, 3, 5, 7, 9, 11}");
+    }
+
+    SECTION("Concurrent first use evaluates once") {
+        auto A = cached((V * V) | dsl::filter(allowed));
+        std::vector<std::thread> ts;
+        std::atomic<std::size_t> total{ 0 };
+        for (int t = 0; t < 4; ++t)
+            ts.emplace_back([&] { total += A.size(); });
+        for (auto& t : ts) t.join();
+        REQUIRE(calls == 144);
+        REQUIRE(total == 4 * A.size());
+    }
+}
+
+// ============================================================================
+// SECTION O: BLOCK-WISE (BATCH) FILTERING
+// ============================================================================
+
+/**
+ * @test BatchFilter::MatchesScalarFilter
+ * @brief Verifies filter_batch yields the same elements as filter
+ *
+ * @scenario Scalar and batch predicates over domains straddling block edges
+ * @given RangeView, IndexList and IntervalSet domains of varying length
+ * @when Iterating `D | filter_batch(p)` and `D | filter(p)`
+ * @then Both produce identical sequences; iterator copies stay independent
+ *
+ * @covers filter_batch, BatchFiltered::iterator, operator|
+ */
+TEST_CASE("O1: BatchFilter::MatchesScalarFilter", "[BatchFiltered]") {
+    auto pred = [](int t) { return (t * 7 + 3) % 5 < 2; };
+    auto batch = [&](std::span<const int> xs, std::span<std::uint8_t> keep) {
+        for (std::size_t k = 0; k < xs.size(); ++k)
+            keep[k] = pred(xs[k]);
+    };
+    auto collect = [](const auto& view) {
+        std::vector<int> out;
+        for (int x : view) out.push_back(x);
+        return out;
+    };
+
+    for (int n : { 0, 1, 255, 256, 257, 1000 }) {
+        RangeView R = range_view(-3, n * 2 - 3, 2);
+        auto expected = collect(R | dsl::filter(pred));
+        REQUIRE(collect(R | dsl::filter_batch(pred)) == expected);
+        REQUIRE(collect(R | dsl::filter_batch(batch)) == expected);
+
+        std::vector<int> v(static_cast<std::size_t>(n));
+        for (int k = 0; k < n; ++k) v[static_cast<std::size_t>(k)] = (k * 37) % 101 - 50;
+        IndexList L(std::move(v));
+        REQUIRE(collect(L | dsl::filter_batch(pred)) == collect(L | dsl::filter(pred)));
+    }
+
+    IntervalSet S{ {0, 300}, {600, 700} };
+    REQUIRE(collect(S | dsl::filter_batch(pred)) == collect(S | dsl::filter(pred)));
+
+    SECTION("Sparse selection skips empty blocks") {
+        auto F = range_view(0, 5000) | dsl::filter_batch([](int t) { return t == 4097; });
+        REQUIRE(collect(F) == std::vector<int>{ 4097 });
+        auto none = range_view(0, 5000) | dsl::filter_batch([](int) { return false; });
+        REQUIRE(none.begin() == none.end());
+    }
+
+    SECTION("Ranges ending next to INT_MAX do not step past it") {
+        const RangeView R = range_view(INT_MAX - 20, INT_MAX, 7);   // last value INT_MAX - 6
+        auto byThree = [](int t) { return t % 3 == 0; };
+        std::vector<int> expected;
+        for (std::size_t k = 0; k < R.size(); ++k)
+            if (byThree(R[k])) expected.push_back(R[k]);
+        REQUIRE(collect(R | dsl::filter_batch(byThree)) == expected);
+        REQUIRE(expected == std::vector<int>{ INT_MAX - 13 });
+    }
+
+    SECTION("Iterator copies are small and advance independently") {
+        auto F = range_view(0, 1000) | dsl::filter_batch(pred);
+        using It = decltype(F.begin());
+        static_assert(sizeof(It) <= 128, "BatchFiltered::iterator must not carry a value buffer");
+
+        auto a = F.begin();
+        auto b = a++;
+        REQUIRE(*b == 1);
+        REQUIRE(*a == 4);
+        for (int k = 0; k < 200; ++k) ++a;      // crosses block boundaries
+        REQUIRE(*a == 504);
+        REQUIRE(*b == 1);
+        REQUIRE(std::distance(b, F.end()) == 400);
+    }
+}
+
+/**
+ * @test BatchFilter::MaterializeAndCompose
+ * @brief Verifies materialize(), cached() and nested filtering on BatchFiltered
+ *
+ * @covers BatchFiltered::materialize, cached, Filtered<BatchFiltered>
+ */
+TEST_CASE("O2: BatchFilter::MaterializeAndCompose", "[BatchFiltered]") {
+    std::vector<int> load(3000);
+    for (std::size_t t = 0; t < load.size(); ++t) load[t] = static_cast<int>((t * 13) % 7) - 2;
+    auto busy = [&](int t) { return load[static_cast<std::size_t>(t)] > 0; };
+
+    auto F = range_view(0, 3000) | dsl::filter_batch(busy);
+    IndexList M = F.materialize();
+    std::vector<int> expected;
+    for (int t = 0; t < 3000; ++t)
+        if (busy(t)) expected.push_back(t);
+    REQUIRE(std::vector<int>(M.begin(), M.end()) == expected);
+
+    auto G = F | dsl::filter([](int t) { return t % 2 == 0; });
+    std::size_t evens = 0;
+    for (int t : G) { REQUIRE(busy(t)); ++evens; }
+    REQUIRE(evens == static_cast<std::size_t>(std::count_if(expected.begin(), expected.end(),
+                                                            [](int t) { return t % 2 == 0; })));
+
+    auto C = cached(F);
+    REQUIRE(C.size() == expected.size());
+    IndexList K{ 0, 1 };
+    auto P = C * K;
+    REQUIRE(P.size() == 2 * expected.size());
+}
+
+// ============================================================================
+// SECTION P: GROUP-BY INDEX OVER TUPLE DOMAINS
+// ============================================================================
+
+/**
+ * @test GroupBy::SlicesMatchScan
+ * @brief Verifies group_by<Dim> slices equal a full scan filtered on the key
+ *
+ * @scenario Sparse arc set expressed as a filtered product
+ * @given Arcs (i, j) over 0..39 with a sparse predicate
+ * @when Grouping by component 0 and by component 1
+ * @then Each slice holds exactly the arcs with that key, in domain order
+ *
+ * @covers group_by, GroupIndex::operator[], count, keys
+ */
+TEST_CASE("P1: GroupBy::SlicesMatchScan", "[GroupIndex]") {
+    IndexList V = range(0, 40);
+    auto arcs = (V * V) | dsl::filter([](int i, int j) { return i != j && (i * 11 + j * 5) % 7 == 0; });
+
+    auto out = group_by<0>(arcs);
+    auto in = group_by<1>(arcs);
+
+    std::size_t total = 0;
+    for (int v = 0; v < 40; ++v) {
+        std::vector<std::tuple<int, int>> outScan, inScan;
+        for (auto [i, j] : arcs) {
+            if (i == v) outScan.emplace_back(i, j);
+            if (j == v) inScan.emplace_back(i, j);
+        }
+        auto o = out[v];
+        auto n = in[v];
+        REQUIRE(std::vector<std::tuple<int, int>>(o.begin(), o.end()) == outScan);
+        REQUIRE(std::vector<std::tuple<int, int>>(n.begin(), n.end()) == inScan);
+        REQUIRE(out.count(v) == outScan.size());
+        total += out.count(v);
+    }
+    REQUIRE(total == out.size());
+    REQUIRE(out[-5].empty());
+    REQUIRE(out[1000].empty());
+    REQUIRE(out.keys().size() <= 40);
+}
+
+/**
+ * @test GroupBy::DomainKinds
+ * @brief Verifies group_by over Cartesian, scalar, Relation, sparse-key and empty domains
+ *
+ * @covers group_by, GroupIndex
+ */
+TEST_CASE("P2: GroupBy::DomainKinds", "[GroupIndex]") {
+    SECTION("Cartesian with unsorted, negative keys") {
+        IndexList I{ 3, -2, 3 };
+        IndexList J{ 7, 8 };
+        auto G = group_by<0>(I * J * range_view(0, 2));
+        REQUIRE(G.size() == 12);
+        REQUIRE(G.count(3) == 8);
+        REQUIRE(G.count(-2) == 4);
+        REQUIRE(G.keys().raw() == std::vector<int>{ -2, 3 });
+        REQUIRE(G[-2][0] == std::tuple{ -2, 7, 0 });
+        REQUIRE(G[3][4] == std::tuple{ 3, 7, 0 });  // second occurrence of 3
+    }
+
+    SECTION("Scalar domain groups by value") {
+        auto G = group_by<0>(IndexList{ 5, 1, 5, 2 });
+        REQUIRE(G.count(5) == 2);
+        REQUIRE(G[1].size() == 1);
+    }
+
+    SECTION("Relation and empty domains") {
+        Relation<2> A{ {0, 1}, {2, 1}, {1, 0} };
+        auto in = group_by<1>(A);
+        auto s = in[1];
+        REQUIRE(std::vector<std::tuple<int, int>>(s.begin(), s.end()) ==
+                std::vector<std::tuple<int, int>>{ {0, 1}, {2, 1} });
+
+        auto E = group_by<0>(IndexList{} * IndexList{ 1 });
+        REQUIRE(E.empty());
+        REQUIRE(E[0].empty());
+        REQUIRE(E.keys().empty());
+    }
+
+    SECTION("Sparse keys are found by binary search") {
+        IndexList ids{ 2'000'000'000, 0, -2'000'000'000, 0 };
+        auto G = group_by<0>(ids * IndexList{ 1, 2 });
+        REQUIRE(G.count(0) == 4);
+        REQUIRE(G.count(2'000'000'000) == 2);
+        REQUIRE(G.count(5) == 0);
+        REQUIRE(G.keys().raw() == std::vector<int>{ -2'000'000'000, 0, 2'000'000'000 });
+        REQUIRE(G[-2'000'000'000][1] == std::tuple{ -2'000'000'000, 2 });
+    }
+}
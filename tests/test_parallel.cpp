@@ -0,0 +1,218 @@
+/*
+===============================================================================
+TEST PARALLEL  Tests for parallel.h
+===============================================================================
+
+OVERVIEW
+--------
+Validates the work-stealing pool and the parallel loops built on it: every
+task/element runs exactly once, exceptions propagate to the caller, and
+parallel_sum() reproduces the serial sum() term-for-term with a bit-identical
+constant across pool sizes and domain kinds.
+
+TEST ORGANIZATION
+-----------------
+ Section A: WorkStealingPool scheduling and exceptions
+ Section B: parallel_for coverage over index domains
+ Section C: parallel_sum determinism against sum()
+
+DEPENDENCIES
+------------
+ Catch2 v3.0+ - Test framework
+ parallel.h - System under test
+ variables.h, indexing.h, expressions.h - Domains and reference sums
+
+===============================================================================
+*/
+
+#include "catch_amalgamated.hpp"
+#include <gurobi_dsl/parallel.h>
+#include <gurobi_dsl/variables.h>
+#include <gurobi_dsl/indexing.h>
+#include <gurobi_dsl/expressions.h>
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// ============================================================================
+// TEST UTILITIES
+// ============================================================================
+
+static GRBModel makeModel() {
+    static GRBEnv env = GRBEnv(true);
+    env.set(GRB_IntParam_OutputFlag, 0);
+    env.start();
+    return GRBModel(env);
+}
+
+/// Exact (bitwise) equality of two expressions: same vars, coefficients, constant
+static bool identical(const GRBLinExpr& a, const GRBLinExpr& b) {
+    if (a.size() != b.size()) return false;
+    for (unsigned int k = 0; k < a.size(); ++k) {
+        if (!a.getVar(k).sameAs(b.getVar(k))) return false;
+        if (std::bit_cast<std::uint64_t>(a.getCoeff(k)) != std::bit_cast<std::uint64_t>(b.getCoeff(k)))
+            return false;
+    }
+    return std::bit_cast<std::uint64_t>(a.getConstant()) == std::bit_cast<std::uint64_t>(b.getConstant());
+}
+
+// ============================================================================
+// SECTION A: WORKSTEALINGPOOL SCHEDULING AND EXCEPTIONS
+// ============================================================================
+
+/**
+ * @test WorkStealingPool::RunsEveryTaskOnce
+ * @brief Verifies run() executes each task id exactly once
+ *
+ * @scenario Pools of several sizes, uneven task costs, repeated runs
+ * @given A pool and a per-task counter
+ * @when Calling run(n, task)
+ * @then Every counter equals the number of runs
+ *
+ * @covers WorkStealingPool::run, WorkStealingPool::size
+ */
+TEST_CASE("A1: WorkStealingPool::RunsEveryTaskOnce", "[parallel][pool]") {
+    for (unsigned threads : { 1u, 2u, 5u }) {
+        dsl::WorkStealingPool pool(threads);
+        REQUIRE(pool.size() == threads);
+
+        std::vector<std::atomic<int>> hits(1000);
+        for (int round = 0; round < 3; ++round) {
+            pool.run(hits.size(), [&](std::size_t t) {
+                volatile double spin = 0;
+                for (std::size_t k = 0; k < (t % 7) * 200; ++k) spin = spin + 1.0;
+                hits[t].fetch_add(1);
+            });
+        }
+        for (auto& h : hits)
+            REQUIRE(h.load() == 3);
+    }
+}
+
+/**
+ * @test WorkStealingPool::ExceptionsAndNesting
+ * @brief Verifies exception propagation and inline nested runs
+ *
+ * @covers WorkStealingPool::run
+ */
+TEST_CASE("A2: WorkStealingPool::ExceptionsAndNesting", "[parallel][pool]") {
+    dsl::WorkStealingPool pool(4);
+
+    REQUIRE_THROWS_AS(pool.run(100, [](std::size_t t) {
+        if (t == 42) throw std::runtime_error("task failed");
+    }), std::runtime_error);
+
+    // The pool stays usable after a failed run
+    std::atomic<int> count{ 0 };
+    pool.run(50, [&](std::size_t) { count.fetch_add(1); });
+    REQUIRE(count.load() == 50);
+
+    // run() from inside a task executes inline instead of deadlocking
+    std::atomic<int> inner{ 0 };
+    pool.run(8, [&](std::size_t) {
+        pool.run(10, [&](std::size_t) { inner.fetch_add(1); });
+    });
+    REQUIRE(inner.load() == 80);
+}
+
+// ============================================================================
+// SECTION B: PARALLEL_FOR COVERAGE OVER INDEX DOMAINS
+// ============================================================================
+
+/**
+ * @test ParallelFor::VisitsEachElementOnce
+ * @brief Verifies parallel_for covers random-access, indexable and filtered domains
+ *
+ * @covers parallel_for
+ */
+TEST_CASE("B1: ParallelFor::VisitsEachElementOnce", "[parallel][parallel_for]") {
+    dsl::WorkStealingPool pool(4);
+    auto I = dsl::range(0, 30);
+    auto R = dsl::range_view(0, 40);
+    dsl::IntervalSet T{ {0, 10}, {20, 30} };
+
+    SECTION("Cartesian") {
+        std::vector<std::atomic<int>> hits(30 * 40);
+        dsl::parallel_for(pool, I * R, [&](int i, int r) { hits[i * 40 + r].fetch_add(1); });
+        for (auto& h : hits) REQUIRE(h.load() == 1);
+    }
+
+    SECTION("RangeView, IndexList and IntervalSet") {
+        std::vector<std::atomic<int>> hits(40);
+        dsl::parallel_for(pool, R, [&](int r) { hits[r].fetch_add(1); });
+        dsl::parallel_for(pool, I, [&](int i) { hits[i].fetch_add(1); });
+        dsl::parallel_for(pool, T, [&](int t) { hits[t].fetch_add(1); });
+        for (int k = 0; k < 40; ++k) {
+            int expected = 1 + (k < 30 ? 1 : 0) + (T.contains(k) ? 1 : 0);
+            REQUIRE(hits[k].load() == expected);
+        }
+    }
+
+    SECTION("Filtered (enumerated serially, executed in parallel)") {
+        std::vector<std::atomic<int>> hits(30 * 30);
+        auto F = (I * I) | dsl::filter([](int i, int j) { return i < j; });
+        dsl::parallel_for(pool, F, [&](int i, int j) { hits[i * 30 + j].fetch_add(1); });
+        for (int i = 0; i < 30; ++i)
+            for (int j = 0; j < 30; ++j)
+                REQUIRE(hits[i * 30 + j].load() == (i < j ? 1 : 0));
+    }
+
+    SECTION("Empty domain") {
+        int calls = 0;
+        dsl::parallel_for(pool, dsl::IndexList{}, [&](int) { ++calls; });
+        REQUIRE(calls == 0);
+    }
+}
+
+// ============================================================================
+// SECTION C: PARALLEL_SUM DETERMINISM AGAINST SUM()
+// ============================================================================
+
+/**
+ * @test ParallelSum::BitIdenticalToSerial
+ * @brief Verifies parallel_sum matches sum() exactly for every pool size
+ *
+ * @scenario Terms with non-representable coefficients and constants
+ * @given A 2-D variable group and several domains
+ * @when Comparing parallel_sum against sum
+ * @then Variables, coefficients and constant are bitwise identical
+ *
+ * @covers parallel_sum
+ */
+TEST_CASE("C1: ParallelSum::BitIdenticalToSerial", "[parallel][parallel_sum]") {
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 20, 25);
+    model.update();
+
+    auto I = dsl::range(0, 20);
+    auto J = dsl::range_view(0, 25);
+    auto gen = [&](int i, int j) { return (0.1 * i + 1.0 / (j + 3)) * X(i, j) + 0.1 * (i ^ j); };
+    GRBLinExpr serial = dsl::sum(I * J, gen);
+
+    for (unsigned threads : { 1u, 3u, 8u }) {
+        dsl::WorkStealingPool pool(threads);
+        REQUIRE(identical(dsl::parallel_sum(pool, I * J, gen), serial));
+    }
+    REQUIRE(identical(dsl::parallel_sum(I * J, gen), serial));
+
+    SECTION("GRBVar, LinTerm and double terms") {
+        dsl::WorkStealingPool pool(4);
+        auto F = (I * J) | dsl::filter([](int i, int j) { return (i + j) % 3 == 0; });
+
+        REQUIRE(identical(
+            dsl::parallel_sum(pool, F, [&](int i, int j) { return X(i, j); }),
+            dsl::sum(F, [&](int i, int j) { return X(i, j); })));
+
+        REQUIRE(identical(
+            dsl::parallel_sum(pool, I, [&](int i) { return 0.1 * i; }),
+            dsl::sum(I, [&](int i) { return 0.1 * i; })));
+
+        GRBLinExpr viaTerms = dsl::parallel_sum(pool, I * J, [&](int i, int j) {
+            return dsl::term(0.5 * i - j, X(i, j));
+        });
+        REQUIRE(identical(viaTerms, dsl::sum(I * J, [&](int i, int j) { return (0.5 * i - j) * X(i, j); })));
+    }
+}
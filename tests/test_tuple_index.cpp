@@ -0,0 +1,354 @@
+/*
+===============================================================================
+TEST TUPLE_INDEX  Tests for tuple_index.h and indexed-set lookups
+===============================================================================
+
+OVERVIEW
+--------
+Validates the integer-tuple hash index used by IndexedVariableSet: insertion
+order positions, duplicate handling, arity rules, heterogeneous lookup and
+growth across rehashes, plus the allocation-free lookup paths of
+IndexedVariableSet built on top of it.
+
+TEST ORGANIZATION
+-----------------
+ Section A: TupleIndex insertion and lookup
+ Section B: TupleIndex arity rules and growth
+ Section C: Indexed-set lookups through TupleIndex (incl. out-of-int-range indices)
+ Section D: Dense rank-bitmap layout (densify)
+
+DEPENDENCIES
+------------
+ Catch2 v3.0+ - Test framework
+ tuple_index.h - System under test
+ variables.h, constraints.h, indexing.h - Indexed set and SparseVars integration
+
+===============================================================================
+*/
+
+#include "catch_amalgamated.hpp"
+#include <gurobi_dsl/tuple_index.h>
+#include <gurobi_dsl/variables.h>
+#include <gurobi_dsl/constraints.h>
+#include <gurobi_dsl/indexing.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <span>
+#include <vector>
+
+// ============================================================================
+// TEST UTILITIES
+// ============================================================================
+
+static GRBModel makeModel() {
+    static GRBEnv env = GRBEnv(true);
+    env.set(GRB_IntParam_OutputFlag, 0);
+    env.start();
+    return GRBModel(env);
+}
+
+// ============================================================================
+// SECTION A: TUPLEINDEX INSERTION AND LOOKUP
+// ============================================================================
+
+/**
+ * @test TupleIndex::PositionsFollowInsertionOrder
+ * @brief Verifies find() returns the insertion position of each key
+ *
+ * @covers TupleIndex::insert(), find(), key()
+ */
+TEST_CASE("A1: TupleIndex::PositionsFollowInsertionOrder", "[tuple_index]")
+{
+    dsl::TupleIndex idx;
+    REQUIRE(idx.empty());
+    REQUIRE(idx.arity() == -1);
+    REQUIRE(idx.find(0, 0) == dsl::TupleIndex::npos);
+
+    REQUIRE(idx.insert(std::vector<int>{ 3, -1 }));
+    REQUIRE(idx.insert(std::array<int, 2>{ 0, 7 }));
+    REQUIRE(idx.insert(std::vector<int>{ -1, 3 }));
+
+    REQUIRE(idx.size() == 3);
+    REQUIRE(idx.arity() == 2);
+    REQUIRE(idx.find(3, -1) == 0);
+    REQUIRE(idx.find(0, 7) == 1);
+    REQUIRE(idx.find(-1, 3) == 2);
+    REQUIRE(idx.find(7, 0) == dsl::TupleIndex::npos);
+
+    auto k = idx.key(1);
+    REQUIRE(k.size() == 2);
+    REQUIRE(k[0] == 0);
+    REQUIRE(k[1] == 7);
+}
+
+/**
+ * @test TupleIndex::HeterogeneousLookup
+ * @brief Verifies variadic, std::array, std::vector and std::span lookups agree
+ *
+ * @covers TupleIndex::find() overloads, contains()
+ */
+TEST_CASE("A2: TupleIndex::HeterogeneousLookup", "[tuple_index]")
+{
+    dsl::TupleIndex idx;
+    idx.insert(std::vector<int>{ 1, 2, 3 });
+
+    const std::array<int, 3> arr{ 1, 2, 3 };
+    const std::vector<int> vec{ 1, 2, 3 };
+    const int raw[3] = { 1, 2, 3 };
+
+    REQUIRE(idx.find(1, 2, 3) == 0);
+    REQUIRE(idx.find(1L, std::size_t{ 2 }, short{ 3 }) == 0);
+    REQUIRE(idx.find(arr) == 0);
+    REQUIRE(idx.find(vec) == 0);
+    REQUIRE(idx.find(std::span<const int>(raw)) == 0);
+    REQUIRE(idx.contains(1, 2, 3));
+    REQUIRE_FALSE(idx.contains(3, 2, 1));
+}
+
+/**
+ * @test TupleIndex::DuplicatesKeepFirstPosition
+ * @brief Verifies duplicate keys still occupy a position but resolve to the first
+ *
+ * @covers TupleIndex::insert() return value
+ */
+TEST_CASE("A3: TupleIndex::DuplicatesKeepFirstPosition", "[tuple_index]")
+{
+    dsl::TupleIndex idx;
+    REQUIRE(idx.insert(std::vector<int>{ 5 }));
+    REQUIRE_FALSE(idx.insert(std::vector<int>{ 5 }));
+    REQUIRE(idx.insert(std::vector<int>{ 6 }));
+
+    REQUIRE(idx.size() == 3);
+    REQUIRE(idx.find(5) == 0);
+    REQUIRE(idx.find(6) == 2);
+    REQUIRE(idx.key(1)[0] == 5);
+}
+
+// ============================================================================
+// SECTION B: TUPLEINDEX ARITY RULES AND GROWTH
+// ============================================================================
+
+/**
+ * @test TupleIndex::ArityIsFixedByFirstKey
+ * @brief Verifies mismatched arity throws on insert and misses on lookup
+ *
+ * @covers TupleIndex::insert() validation, find() arity check
+ */
+TEST_CASE("B1: TupleIndex::ArityIsFixedByFirstKey", "[tuple_index]")
+{
+    dsl::TupleIndex idx;
+    idx.insert(std::vector<int>{ 1, 2 });
+
+    REQUIRE_THROWS_AS(idx.insert(std::vector<int>{ 1 }), std::invalid_argument);
+    REQUIRE(idx.find(1) == dsl::TupleIndex::npos);
+    REQUIRE(idx.find(1, 2, 0) == dsl::TupleIndex::npos);
+    REQUIRE(idx.size() == 1);
+}
+
+/**
+ * @test TupleIndex::GrowthPreservesAllKeys
+ * @brief Verifies every key survives repeated rehashing, with and without reserve
+ *
+ * @covers TupleIndex::insert() growth, reserve()
+ */
+TEST_CASE("B2: TupleIndex::GrowthPreservesAllKeys", "[tuple_index]")
+{
+    for (bool reserveFirst : { false, true }) {
+        dsl::TupleIndex idx;
+        if (reserveFirst) {
+            idx.reserve(100 * 100);
+        }
+        for (int i = 0; i < 100; ++i) {
+            for (int j = 0; j < 100; ++j) {
+                idx.insert(std::array<int, 2>{ i * 7 - 300, j });
+            }
+        }
+
+        REQUIRE(idx.size() == 10000);
+        bool allFound = true;
+        for (int i = 0; i < 100; ++i) {
+            for (int j = 0; j < 100; ++j) {
+                allFound = allFound &&
+                    idx.find(i * 7 - 300, j) == static_cast<std::size_t>(i * 100 + j);
+            }
+        }
+        REQUIRE(allFound);
+        REQUIRE(idx.find(1, 100) == dsl::TupleIndex::npos);
+    }
+}
+
+// ============================================================================
+// SECTION C: INDEXEDVARIABLESET LOOKUPS THROUGH TUPLEINDEX
+// ============================================================================
+
+/**
+ * @test IndexedLookup::VariadicAndVectorAgree
+ * @brief Verifies IndexedVariableSet lookups resolve through the tuple index
+ *
+ * @scenario A filtered 3-D domain is materialized
+ * @given X over {(i,j,k) : i + j + k even}
+ * @when Looking up each entry by variadic ints, mixed integral types and vectors
+ * @then All forms return the entry's variable; absent and wrong-arity keys miss
+ *
+ * @covers IndexedVariableSet::at(), try_get()
+ */
+TEST_CASE("C1: IndexedLookup::VariadicAndVectorAgree", "[tuple_index][indexed]")
+{
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 4);
+    auto X = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "X",
+        (I * I * I) | dsl::filter([](int i, int j, int k) { return (i + j + k) % 2 == 0; }));
+
+    REQUIRE(X.size() == 32);
+    for (const auto& e : X) {
+        const int i = e.index[0], j = e.index[1], k = e.index[2];
+        REQUIRE(X.at(i, j, k).sameAs(e.var));
+        REQUIRE(X.at(static_cast<long long>(i), static_cast<std::size_t>(j), k).sameAs(e.var));
+        REQUIRE(X.at(e.index).sameAs(e.var));
+        REQUIRE(X.try_get(e.index) == &X.at(i, j, k));
+    }
+
+    REQUIRE(X.try_get(0, 0, 1) == nullptr);
+    REQUIRE(X.try_get(0, 0) == nullptr);
+    REQUIRE(X.try_get(std::vector<int>{ 0, 0, 0, 0 }) == nullptr);
+    REQUIRE_THROWS_AS(X.at(0, 0, 1), std::out_of_range);
+}
+
+/**
+ * @test IndexedLookup::WideIndicesOutsideIntRangeMiss
+ * @brief Verifies long long / size_t indices beyond int range miss instead of wrapping
+ *
+ * @scenario Keys include 0, which 1LL << 32 would narrow onto
+ * @given A TupleIndex, an IndexedVariableSet, a SparseVars<1> and an IndexedConstraintSet
+ * @when Looking up indices outside [INT_MIN, INT_MAX]
+ * @then find() returns npos, try_get() nullptr and at() throws std::out_of_range
+ *
+ * @covers TupleIndex::fitsKey(), TupleIndex::find(I...), IndexedVariableSet::at(),
+ *         SparseVars::at(), SparseVars::try_get(), IndexedConstraintSet::try_get()
+ */
+TEST_CASE("C2: IndexedLookup::WideIndicesOutsideIntRangeMiss", "[tuple_index][indexed][edge]")
+{
+    const long long wrapsToZero = 1LL << 32;
+    const long long wrapsToMinusOne = -(1LL << 32) - 1;
+    const std::size_t hugeUnsigned = std::size_t{ 1 } << 32;
+
+    static_assert(dsl::TupleIndex::fitsKey(INT_MAX) && dsl::TupleIndex::fitsKey(INT_MIN));
+    static_assert(dsl::TupleIndex::fitsKey(static_cast<long long>(INT_MIN)));
+    static_assert(!dsl::TupleIndex::fitsKey(static_cast<long long>(INT_MAX) + 1));
+    static_assert(!dsl::TupleIndex::fitsKey(static_cast<unsigned>(INT_MAX) + 1u));
+
+    dsl::TupleIndex idx;
+    idx.insert(std::vector<int>{ 0, -1 });
+    REQUIRE(idx.find(0LL, -1LL) == 0);
+    REQUIRE(idx.find(wrapsToZero, -1) == dsl::TupleIndex::npos);
+    REQUIRE(idx.find(0, wrapsToMinusOne) == dsl::TupleIndex::npos);
+    REQUIRE_FALSE(idx.contains(hugeUnsigned, -1));
+
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "X", dsl::range(0, 3));
+    REQUIRE(X.try_get(0LL) == &X.at(0));
+    REQUIRE(X.try_get(wrapsToZero) == nullptr);
+    REQUIRE(X.try_get(hugeUnsigned) == nullptr);
+    REQUIRE_THROWS_AS(X.at(wrapsToZero), std::out_of_range);
+
+    dsl::SparseVars<1> S(X);
+    REQUIRE(S.try_get(std::size_t{ 2 }) == &S.at(2));
+    REQUIRE(S.try_get(wrapsToZero) == nullptr);
+    REQUIRE_THROWS_AS(S.at(wrapsToZero), std::out_of_range);
+    REQUIRE_THROWS_AS(S.at(hugeUnsigned), std::out_of_range);
+
+    auto C = dsl::ConstraintFactory::addIndexed(model, "c", dsl::range(0, 3),
+        [&](int i) { return X(i) <= 1; });
+    REQUIRE(C.try_get(0) != nullptr);
+    REQUIRE(C.try_get(wrapsToZero) == nullptr);
+    REQUIRE_THROWS_AS(C.at(wrapsToZero), std::out_of_range);
+}
+
+// ============================================================================
+// SECTION D: DENSE RANK-BITMAP LAYOUT
+// ============================================================================
+
+/**
+ * @test TupleIndex::DenseLayoutMatchesHash
+ * @brief Verifies densify() answers every lookup exactly like the hash layout
+ *
+ * @scenario Keys covering ~30% of a box, in row-major and shuffled order
+ * @given Two identical indexes, one densified
+ * @when Probing every cell of an enlarged box (inside and outside the keys)
+ * @then Positions, misses and duplicate resolution agree
+ *
+ * @covers TupleIndex::densify(), TupleIndex::dense(), TupleIndex::find()
+ */
+TEST_CASE("D1: TupleIndex::DenseLayoutMatchesHash", "[tuple_index][dense]")
+{
+    std::vector<std::array<int, 3>> ks;
+    for (int i = -2; i < 6; ++i)
+        for (int j = 0; j < 9; ++j)
+            for (int k = 3; k < 10; ++k)
+                if ((i * 7 + j * 3 + k + 100) % 10 < 3) ks.push_back({ i, j, k });
+
+    SECTION("Row-major insertion order") {}
+    SECTION("Shuffled insertion order with duplicates") {
+        std::reverse(ks.begin(), ks.end());
+        std::rotate(ks.begin(), ks.begin() + 17, ks.end());
+        ks.push_back(ks[5]);
+        ks.push_back(ks[0]);
+    }
+
+    dsl::TupleIndex hashed, packed;
+    for (const auto& k : ks) {
+        hashed.insert(k);
+        packed.insert(k);
+    }
+    REQUIRE(packed.densify());
+    REQUIRE(packed.dense());
+    REQUIRE_FALSE(hashed.dense());
+
+    for (int i = -4; i < 8; ++i)
+        for (int j = -1; j < 11; ++j)
+            for (int k = 1; k < 12; ++k)
+                REQUIRE(packed.find(i, j, k) == hashed.find(i, j, k));
+    REQUIRE(packed.find(0, 0) == dsl::TupleIndex::npos);
+
+    // A later insert falls back to the hash table and keeps all keys
+    packed.insert(std::array{ 100, 100, 100 });
+    REQUIRE_FALSE(packed.dense());
+    REQUIRE(packed.find(100, 100, 100) == ks.size());
+    for (const auto& k : ks)
+        REQUIRE(packed.find(k) == hashed.find(k));
+}
+
+/**
+ * @test TupleIndex::SparseBoxStaysHashed
+ * @brief Verifies densify() refuses sparse boxes and addIndexed picks the layout
+ *
+ * @covers TupleIndex::densify(), IndexedVariableSet::denseLookup()
+ */
+TEST_CASE("D2: TupleIndex::SparseBoxStaysHashed", "[tuple_index][dense]")
+{
+    dsl::TupleIndex idx;
+    idx.insert(std::array{ 0, 0 });
+    idx.insert(std::array{ 1000, 1000 });
+    REQUIRE_FALSE(idx.densify());
+    REQUIRE(idx.find(1000, 1000) == 1);
+
+    dsl::TupleIndex none;
+    REQUIRE_FALSE(none.densify());
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 20);
+    auto X = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "X",
+        (I * I) | dsl::filter([](int i, int j) { return (i + 2 * j) % 3 == 0; }));
+    REQUIRE(X.denseLookup());
+    for (const auto& e : X)
+        REQUIRE(X.at(e.index[0], e.index[1]).sameAs(e.var));
+    REQUIRE(X.try_get(0, 1) == nullptr);
+    REQUIRE(X.try_get(20, 0) == nullptr);
+
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "Y",
+        dsl::IndexList{ 0, 100000 } * dsl::IndexList{ 0, 100000 });
+    REQUIRE_FALSE(Y.denseLookup());
+    REQUIRE(Y.at(100000, 0).sameAs(Y.all()[2].var));
+}
@@ -25,6 +25,14 @@ TEST ORGANIZATION
  Section K: Variable type coverage (BINARY, CONTINUOUS, INTEGER)
  Section L: Variable modification utilities (fix, unfix, setStart, bounds)
  Section M: Solution extraction utilities (value, values, valueAt)
+ Section N: Batched variable creation (chunked addVars)
+ Section O: VariableGroup flat strided storage
+ Section P: Bulk attribute queries (getAttr)
+ Section Q: Bulk variable modification (fixAll, setStartAll, setLB, setUB)
+ Section R: Grouping IndexedVariableSet entries (group_by)
+ Section S: IndexedVariableSet structure-of-arrays entry storage
+ Section T: Statically ranked containers (VarArray<N>, SparseVars<N>)
+ Section U: Column reverse index (VariableTable::locate)
 
 TEST STRATEGY
 -------------
@@ -663,6 +671,68 @@ TEST_CASE("D5: ForEachIteration::ConstForEach", "[variables][iteration][const]")
     REQUIRE(count == 6);
 }
 
+template<typename T>
+concept CanForEachVar = requires(T& t, void (*fn)(const GRBVar&)) { t.forEachVar(fn); };
+
+template<typename T>
+concept CanForEachConstr = requires(T& t, void (*fn)(const GRBConstr&)) { t.forEachConstr(fn); };
+
+/**
+ * @test ForEachIteration::IndexFreeTraversal
+ * @brief Verifies forEachVar / forEachFlat visit storage order without index tuples
+ *
+ * @scenario Dense, sparse and container traversals compared with flat()
+ * @given A 2x3 VariableGroup and a 1-D IndexedVariableSet, also wrapped in containers
+ * @when Iterating with forEachVar and forEachFlat (mutable and const)
+ * @then Each variable is visited once, in flat() order, with k == its position
+ *
+ * @covers FlatTraversal (VariableGroup, IndexedVariableSet, VariableContainer),
+ *         VariableContainer::flat
+ */
+TEST_CASE("D6: ForEachIteration::IndexFreeTraversal", "[variables][iteration][forEachVar]")
+{
+    // FlatTraversal offers forEachConstr only on constraint containers
+    static_assert(!CanForEachConstr<dsl::VariableGroup>);
+    static_assert(CanForEachVar<const dsl::VariableContainer>);
+
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 2, 3);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "Y", dsl::IndexList{ 4, 7, 9 });
+    model.update();
+
+    std::size_t seen = 0;
+    X.forEachVar([&](GRBVar& v) {
+        REQUIRE(v.sameAs(X.flat()[seen++]));
+    });
+    REQUIRE(seen == X.count());
+
+    const auto& constX = X;
+    seen = 0;
+    constX.forEachFlat([&](std::size_t k, const GRBVar& v) {
+        REQUIRE(k == seen++);
+        REQUIRE(v.sameAs(X(static_cast<int>(k / 3), static_cast<int>(k % 3))));
+    });
+    REQUIRE(seen == 6);
+
+    seen = 0;
+    Y.forEachFlat([&](std::size_t k, GRBVar& v) {
+        REQUIRE(v.sameAs(Y.all()[k].var));
+        ++seen;
+    });
+    REQUIRE(seen == 3);
+
+    const dsl::VariableContainer dense(X);
+    const dsl::VariableContainer sparse(Y);
+    seen = 0;
+    dense.forEachVar([&](const GRBVar&) { ++seen; });
+    sparse.forEachVar([&](const GRBVar&) { ++seen; });
+    REQUIRE(seen == 9);
+    REQUIRE(sparse.flat().size() == 3);
+
+    dsl::VariableContainer none;
+    REQUIRE_THROWS_AS(none.forEachVar([](GRBVar&) {}), std::runtime_error);
+}
+
 // ============================================================================
 // SECTION E: VARIABLETABLE NAMING AND ACCESS PATTERNS
 // ============================================================================
@@ -1409,7 +1479,7 @@ TEST_CASE("I4: IndexedVariableSetIteration::BeginEndIterators", "[variables][ind
     model.update();
 
     int count = 0;
-    for (auto& entry : X) {
+    for (const auto& entry : X) {
         REQUIRE(entry.index.size() == 1);
         REQUIRE((entry.index[0] == 1 || entry.index[0] == 3 || entry.index[0] == 5));
         count++;
@@ -2314,4 +2384,768 @@ TEST_CASE("M8: SolutionExtraction::RoundTripFixAllValues", "[variables][solution
     REQUIRE(dsl::ub(V.at(1)) == Catch::Approx(2.0));
     REQUIRE(dsl::lb(V.at(2)) == Catch::Approx(3.0));
     REQUIRE(dsl::ub(V.at(2)) == Catch::Approx(3.0));
-}
\ No newline at end of file
+}
+// ============================================================================
+// SECTION N: BATCHED VARIABLE CREATION
+// ============================================================================
+
+/// Restores the process-wide addVars chunk size when a test ends
+struct BatchSizeGuard {
+    std::size_t saved = dsl::VariableFactory::batchSize();
+    ~BatchSizeGuard() { dsl::VariableFactory::setBatchSize(saved); }
+};
+
+/**
+ * @test BatchedCreation::ChunkedGroupKeepsRowMajorOrder
+ * @brief Verifies chunked creation of a VariableGroup preserves layout
+ *
+ * @scenario A 3x5 group is created with a chunk size that does not divide 15
+ * @given setBatchSize(4)
+ * @when Creating X(3,5) and updating the model
+ * @then Column indices follow row-major order; bounds, types and names match
+ *
+ * @covers VariableFactory::add() batched path
+ * @covers VariableFactory::setBatchSize()
+ */
+TEST_CASE("N1: BatchedCreation::ChunkedGroupKeepsRowMajorOrder", "[variables][batch][group]")
+{
+    BatchSizeGuard guard;
+    dsl::VariableFactory::setBatchSize(4);
+
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_INTEGER, -2, 7, "X", 3, 5);
+    model.update();
+
+    REQUIRE(model.get(GRB_IntAttr_NumVars) == 15);
+    REQUIRE(X.count() == 15);
+
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            const GRBVar& v = X.at(i, j);
+            REQUIRE(v.index() == i * 5 + j);
+            REQUIRE(v.get(GRB_DoubleAttr_LB) == Catch::Approx(-2.0));
+            REQUIRE(v.get(GRB_DoubleAttr_UB) == Catch::Approx(7.0));
+            REQUIRE(v.get(GRB_CharAttr_VType) == GRB_INTEGER);
+            if (naming_enabled()) {
+                REQUIRE(v.get(GRB_StringAttr_VarName) ==
+                    std::format("X_{}_{}", i, j));
+            }
+        }
+    }
+}
+
+/**
+ * @test BatchedCreation::ChunkedIndexedSetMatchesDomainOrder
+ * @brief Verifies chunked creation of an IndexedVariableSet follows the domain
+ *
+ * @scenario A filtered 2-D domain is materialized with chunk size 2
+ * @given Domain {(i,j) : i < j} over 4x4
+ * @when Creating Y via addIndexed
+ * @then Entries and column indices follow domain order; lookups resolve
+ *
+ * @covers VariableFactory::addIndexed() batched path
+ */
+TEST_CASE("N2: BatchedCreation::ChunkedIndexedSetMatchesDomainOrder", "[variables][batch][indexed]")
+{
+    BatchSizeGuard guard;
+    dsl::VariableFactory::setBatchSize(2);
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 4);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 3, "Y",
+        (I * I) | dsl::filter([](int i, int j) { return i < j; }));
+    model.update();
+
+    REQUIRE(Y.size() == 6);
+    REQUIRE(model.get(GRB_IntAttr_NumVars) == 6);
+
+    int k = 0;
+    for (const auto& e : Y) {
+        REQUIRE(e.var.index() == k++);
+        REQUIRE(e.index[0] < e.index[1]);
+        REQUIRE(Y.at(e.index[0], e.index[1]).sameAs(e.var));
+        if (naming_enabled()) {
+            REQUIRE(e.var.get(GRB_StringAttr_VarName) ==
+                std::format("Y_{}_{}", e.index[0], e.index[1]));
+        }
+    }
+}
+
+/**
+ * @test BatchedCreation::EmptyShapesAndDomains
+ * @brief Verifies zero-sized groups and empty domains create no variables
+ *
+ * @covers VariableFactory::add() with a zero dimension
+ * @covers VariableFactory::addIndexed() with an empty domain
+ */
+TEST_CASE("N3: BatchedCreation::EmptyShapesAndDomains", "[variables][batch][edge]")
+{
+    GRBModel model = makeModel();
+
+    auto X = dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 3, 0);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "Y",
+        dsl::IndexList{});
+    model.update();
+
+    REQUIRE(model.get(GRB_IntAttr_NumVars) == 0);
+    REQUIRE(X.size(0) == 3);
+    REQUIRE(Y.empty());
+}
+
+/**
+ * @test BatchedCreation::InvalidConfiguration
+ * @brief Verifies invalid chunk sizes and negative dimensions are rejected
+ *
+ * @covers VariableFactory::setBatchSize()
+ * @covers VariableFactory::add() size validation
+ */
+TEST_CASE("N4: BatchedCreation::InvalidConfiguration", "[variables][batch][exception]")
+{
+    BatchSizeGuard guard;
+    GRBModel model = makeModel();
+
+    REQUIRE_THROWS_AS(dsl::VariableFactory::setBatchSize(0), std::invalid_argument);
+    REQUIRE_THROWS_AS(dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 2, -1),
+        std::invalid_argument);
+    REQUIRE(dsl::VariableFactory::batchSize() == guard.saved);
+}
+
+// ============================================================================
+// SECTION O: VARIABLEGROUP FLAT STRIDED STORAGE
+// ============================================================================
+
+/**
+ * @test FlatStorage::RowMajorStridesAndFlatView
+ * @brief Verifies the contiguous layout matches at() through row-major strides
+ *
+ * @scenario A 2x3x4 group is created
+ * @given X(2,3,4)
+ * @when Comparing at(i,j,k) with flat()[i*stride(0) + j*stride(1) + k]
+ * @then Both address the same variable, and forEach visits flat() in order
+ *
+ * @covers VariableGroup::flat()
+ * @covers VariableGroup::stride()
+ */
+TEST_CASE("O1: FlatStorage::RowMajorStridesAndFlatView", "[variables][group][flat]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 2, 3, 4);
+    model.update();
+
+    REQUIRE(X.count() == 24);
+    REQUIRE(X.flat().size() == 24);
+    REQUIRE(X.stride(0) == 12);
+    REQUIRE(X.stride(1) == 4);
+    REQUIRE(X.stride(2) == 1);
+    REQUIRE_THROWS_AS(X.stride(3), std::out_of_range);
+
+    for (int i = 0; i < 2; ++i)
+        for (int j = 0; j < 3; ++j)
+            for (int k = 0; k < 4; ++k)
+                REQUIRE(X.at(i, j, k).sameAs(X.flat()[i * 12 + j * 4 + k]));
+
+    std::size_t pos = 0;
+    X.forEach([&](GRBVar& v, const std::vector<int>& idx) {
+        REQUIRE(v.sameAs(X.flat()[pos]));
+        REQUIRE(X.at(idx).sameAs(v));
+        ++pos;
+    });
+    REQUIRE(pos == 24);
+}
+
+/**
+ * @test FlatStorage::ZeroExtentShape
+ * @brief Verifies zero-sized dimensions are reported and hold no variables
+ *
+ * @covers VariableGroup::shape(), count(), forEach() with an empty extent
+ */
+TEST_CASE("O2: FlatStorage::ZeroExtentShape", "[variables][group][flat][edge]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 3, 0);
+
+    REQUIRE(X.shape() == std::vector<std::size_t>{3, 0});
+    REQUIRE(X.count() == 0);
+    REQUIRE(X.size(1) == 0);
+    REQUIRE_THROWS_AS(X.at(0, 0), std::out_of_range);
+
+    int visits = 0;
+    X.forEach([&](GRBVar&, const std::vector<int>&) { ++visits; });
+    REQUIRE(visits == 0);
+}
+
+/**
+ * @test FlatStorage::ConstructFromBufferAndTree
+ * @brief Verifies the buffer and node-tree constructors build the same layout
+ *
+ * @scenario Three variables are wrapped as a 1x3 group both ways
+ * @given A row-major buffer and an equivalent Node tree
+ * @when Constructing VariableGroup from each
+ * @then Element access agrees; mismatched buffers and ragged trees throw
+ *
+ * @covers VariableGroup(std::vector<GRBVar>&&, std::vector<std::size_t>)
+ * @covers VariableGroup(Node&&, int)
+ */
+TEST_CASE("O3: FlatStorage::ConstructFromBufferAndTree", "[variables][group][flat]")
+{
+    GRBModel model = makeModel();
+    GRBVar a = model.addVar(0, 1, 0, GRB_BINARY);
+    GRBVar b = model.addVar(0, 1, 0, GRB_BINARY);
+    GRBVar c = model.addVar(0, 1, 0, GRB_BINARY);
+
+    dsl::VariableGroup fromFlat(std::vector<GRBVar>{ a, b, c }, { 1, 3 });
+
+    dsl::VariableGroup::Node row(3);
+    row.children[0] = dsl::VariableGroup::Node(a);
+    row.children[1] = dsl::VariableGroup::Node(b);
+    row.children[2] = dsl::VariableGroup::Node(c);
+    dsl::VariableGroup::Node root(1);
+    root.children[0] = std::move(row);
+    dsl::VariableGroup fromTree(std::move(root), 2);
+
+    REQUIRE(fromTree.shape() == fromFlat.shape());
+    for (int j = 0; j < 3; ++j) {
+        REQUIRE(fromTree.at(0, j).sameAs(fromFlat.at(0, j)));
+    }
+
+    REQUIRE_THROWS_AS(dsl::VariableGroup(std::vector<GRBVar>{ a, b }, { 3 }),
+        std::invalid_argument);
+
+    dsl::VariableGroup::Node ragged(2);
+    ragged.children[0] = dsl::VariableGroup::Node(std::size_t{ 2 });
+    ragged.children[1] = dsl::VariableGroup::Node(std::size_t{ 1 });
+    REQUIRE_THROWS_AS(dsl::VariableGroup(std::move(ragged), 2), std::invalid_argument);
+}
+
+// ============================================================================
+// SECTION P: BULK ATTRIBUTE QUERIES
+// ============================================================================
+
+/**
+ * @test BulkAttributes::MatchesPerVariableReads
+ * @brief Verifies getAttr() returns the same values as per-variable get()
+ *
+ * @scenario A 2x3 group and a filtered indexed set with distinct bounds/objective
+ * @given Bounds and objective set per variable, then model.update()
+ * @when Reading LB, UB, Obj through getAttr()
+ * @then Values match GRBVar::get() in forEach order
+ *
+ * @covers dsl::getAttr(VariableGroup), dsl::getAttr(IndexedVariableSet)
+ */
+TEST_CASE("P1: BulkAttributes::MatchesPerVariableReads", "[variables][attributes]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 2, 3);
+    auto I = dsl::range(0, 4);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 10, "Y",
+        (I * I) | dsl::filter([](int i, int j) { return i < j; }));
+
+    REQUIRE(X.model() == &model);
+    REQUIRE(Y.model() == &model);
+
+    double k = 0.0;
+    X.forEach([&](GRBVar& v, const std::vector<int>&) {
+        v.set(GRB_DoubleAttr_LB, k);
+        v.set(GRB_DoubleAttr_UB, k + 5.0);
+        v.set(GRB_DoubleAttr_Obj, -k);
+        k += 1.0;
+    });
+    Y.forEach([&](GRBVar& v, const std::vector<int>&) {
+        v.set(GRB_DoubleAttr_UB, k);
+        k += 1.0;
+    });
+    model.update();
+
+    for (GRB_DoubleAttr attr : { GRB_DoubleAttr_LB, GRB_DoubleAttr_UB, GRB_DoubleAttr_Obj }) {
+        auto xs = dsl::getAttr(X, attr);
+        REQUIRE(xs.size() == X.count());
+        std::size_t n = 0;
+        X.forEach([&](const GRBVar& v, const std::vector<int>&) {
+            REQUIRE(xs[n++] == Catch::Approx(v.get(attr)));
+        });
+
+        auto ys = dsl::getAttr(Y, attr);
+        REQUIRE(ys.size() == Y.size());
+        for (std::size_t p = 0; p < Y.size(); ++p) {
+            REQUIRE(ys[p] == Catch::Approx(Y.all()[p].var.get(attr)));
+        }
+    }
+}
+
+/**
+ * @test BulkAttributes::SolutionValuesAndContainers
+ * @brief Verifies values()/valuesWithIndex() built on getAttr(X) after a solve
+ *
+ * @covers dsl::values(), dsl::valuesWithIndex(), dsl::getAttr(VariableContainer)
+ */
+TEST_CASE("P2: BulkAttributes::SolutionValuesAndContainers", "[variables][attributes][solution]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 10, "X", 2, 2);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 10, "Y",
+        dsl::IndexList{ 4, 7 });
+
+    model.addConstr(X(0, 0) == 1.0);
+    model.addConstr(X(0, 1) == 2.0);
+    model.addConstr(X(1, 0) == 3.0);
+    model.addConstr(X(1, 1) == 4.0);
+    model.addConstr(Y(4) == 5.0);
+    model.addConstr(Y(7) == 6.0);
+    model.setObjective(GRBLinExpr(0.0), GRB_MINIMIZE);
+    model.optimize();
+    REQUIRE(model.get(GRB_IntAttr_Status) == GRB_OPTIMAL);
+
+    REQUIRE_THAT(dsl::values(X), Catch::Matchers::Approx(std::vector<double>{ 1, 2, 3, 4 }));
+    REQUIRE_THAT(dsl::getAttr(Y, GRB_DoubleAttr_X),
+        Catch::Matchers::Approx(std::vector<double>{ 5, 6 }));
+
+    auto pairs = dsl::valuesWithIndex(Y);
+    REQUIRE(pairs.size() == 2);
+    REQUIRE(pairs[1].first == std::vector<int>{ 7 });
+    REQUIRE(pairs[1].second == Catch::Approx(6.0));
+
+    auto gpairs = dsl::valuesWithIndex(X);
+    REQUIRE(gpairs[2].first == std::vector<int>{ 1, 0 });
+    REQUIRE(gpairs[2].second == Catch::Approx(3.0));
+
+    dsl::VariableContainer dense(X);
+    dsl::VariableContainer sparse(Y);
+    dsl::VariableContainer none;
+    REQUIRE(dsl::values(dense).size() == 4);
+    REQUIRE(dsl::valuesWithIndex(sparse).size() == 2);
+    REQUIRE_THROWS_AS(dsl::getAttr(none, GRB_DoubleAttr_X), std::runtime_error);
+    REQUIRE_THROWS_AS(dsl::valuesWithIndex(none), std::runtime_error);
+}
+
+/**
+ * @test BulkAttributes::HandBuiltGroups
+ * @brief Verifies groups without a recorded model still work (fallback or explicit model)
+ *
+ * @covers dsl::getAttr(GRBModel&, VariableGroup), VariableGroup::setModel()
+ * @covers dsl::getAttr(VariableGroup, attr, span), dsl::setAttr(GRBModel&, VariableContainer)
+ */
+TEST_CASE("P3: BulkAttributes::HandBuiltGroups", "[variables][attributes]")
+{
+    GRBModel model = makeModel();
+    GRBVar a = model.addVar(1.0, 2.0, 0, GRB_CONTINUOUS);
+    GRBVar b = model.addVar(3.0, 4.0, 0, GRB_CONTINUOUS);
+    model.update();
+
+    dsl::VariableGroup G(std::vector<GRBVar>{ a, b }, { 2 });
+    REQUIRE(G.model() == nullptr);
+
+    const std::vector<double> expected{ 1.0, 3.0 };
+    REQUIRE(dsl::getAttr(G, GRB_DoubleAttr_LB) == expected);
+    REQUIRE(dsl::getAttr(model, G, GRB_DoubleAttr_LB) == expected);
+
+    std::array<double, 2> buf{};
+    dsl::getAttr(model, G, GRB_DoubleAttr_UB, buf);
+    REQUIRE(buf == std::array<double, 2>{ 2.0, 4.0 });
+
+    dsl::VariableContainer C(G);
+    dsl::setAttr(model, C, GRB_DoubleAttr_LB, std::vector<double>{ 1.5, 3.5 });
+    model.update();
+    REQUIRE(dsl::getAttr(model, C, GRB_DoubleAttr_LB) == std::vector<double>{ 1.5, 3.5 });
+
+    std::vector<double> tooShort(1);
+    REQUIRE_THROWS_AS(dsl::getAttr(G, GRB_DoubleAttr_LB, tooShort), std::invalid_argument);
+    REQUIRE_THROWS_AS(dsl::setAttr(model, G, GRB_DoubleAttr_LB, tooShort), std::invalid_argument);
+
+    G.setModel(model);
+    REQUIRE(G.model() == &model);
+    REQUIRE(dsl::getAttr(G, GRB_DoubleAttr_UB) == std::vector<double>{ 2.0, 4.0 });
+    dsl::getAttr(G, GRB_DoubleAttr_LB, buf);
+    REQUIRE(buf == std::array<double, 2>{ 1.5, 3.5 });
+
+    dsl::VariableContainer none;
+    REQUIRE_THROWS_AS(dsl::getAttr(model, none, GRB_DoubleAttr_LB), std::runtime_error);
+}
+
+// ============================================================================
+// SECTION Q: BULK VARIABLE MODIFICATION
+// ============================================================================
+
+/**
+ * @test BulkModification::FixAndBoundsOnIndexedSet
+ * @brief Verifies fixAll/setLB/setUB/setStartAll on an IndexedVariableSet via flat()
+ *
+ * @scenario A filtered 2-D set is modified in bulk
+ * @given Y(i,j) for i < j over 0..3
+ * @when Applying setLB, setUB, setStartAll, then fixAll
+ * @then flat() mirrors the entries and each variable reflects its value
+ *
+ * @covers IndexedVariableSet::flat(), dsl::setLB(), dsl::setUB(), dsl::fixAll()
+ */
+TEST_CASE("Q1: BulkModification::FixAndBoundsOnIndexedSet", "[variables][modification][bulk]")
+{
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 4);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 100, "Y",
+        (I * I) | dsl::filter([](int i, int j) { return i < j; }));
+
+    REQUIRE(Y.flat().size() == Y.size());
+    for (std::size_t k = 0; k < Y.size(); ++k) {
+        REQUIRE(Y.flat()[k].sameAs(Y.all()[k].var));
+    }
+
+    std::vector<double> lo, hi, start;
+    for (const auto& e : Y) {
+        lo.push_back(e.index[0]);
+        hi.push_back(10.0 + e.index[1]);
+        start.push_back(e.index[0] + 0.5);
+    }
+    dsl::setLB(Y, lo);
+    dsl::setUB(Y, hi);
+    dsl::setStartAll(Y, start);
+    model.update();
+
+    REQUIRE(dsl::getAttr(Y, GRB_DoubleAttr_LB) == lo);
+    REQUIRE(dsl::getAttr(Y, GRB_DoubleAttr_UB) == hi);
+    REQUIRE(dsl::getAttr(Y, GRB_DoubleAttr_Start) == start);
+    REQUIRE(dsl::lb(Y(1, 3)) == Catch::Approx(1.0));
+    REQUIRE(dsl::ub(Y(1, 3)) == Catch::Approx(13.0));
+
+    dsl::fixAll(Y, start);
+    model.update();
+    REQUIRE(dsl::getAttr(Y, GRB_DoubleAttr_LB) == start);
+    REQUIRE(dsl::getAttr(Y, GRB_DoubleAttr_UB) == start);
+}
+
+/**
+ * @test BulkModification::GroupAndContainerBounds
+ * @brief Verifies group/container bulk setters and their size checks
+ *
+ * @covers dsl::setAttr(), dsl::setLB(VariableContainer&), dsl::setUB(VariableGroup&)
+ */
+TEST_CASE("Q2: BulkModification::GroupAndContainerBounds", "[variables][modification][bulk]")
+{
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 100, "X", 2, 2);
+
+    const std::array<double, 4> ub{ 4, 3, 2, 1 };
+    dsl::setUB(X, ub);
+
+    dsl::VariableContainer vc(X);
+    const std::vector<double> lb{ 1, 1, 0, 0 };
+    dsl::setLB(vc, lb);
+
+    dsl::setAttr(X, GRB_DoubleAttr_Obj, std::vector<double>{ 1, 2, 3, 4 });
+    model.update();
+
+    REQUIRE(dsl::ub(X(0, 1)) == Catch::Approx(3.0));
+    REQUIRE(dsl::lb(X(0, 1)) == Catch::Approx(1.0));
+    REQUIRE(X(1, 1).get(GRB_DoubleAttr_Obj) == Catch::Approx(4.0));
+
+    const std::vector<double> wrong(3, 0.0);
+    REQUIRE_THROWS_AS(dsl::setLB(X, wrong), std::invalid_argument);
+    REQUIRE_THROWS_AS(dsl::setUB(vc, wrong), std::invalid_argument);
+    REQUIRE_THROWS_AS(dsl::setAttr(X, GRB_DoubleAttr_Obj, wrong), std::invalid_argument);
+
+    dsl::VariableContainer none;
+    REQUIRE_THROWS_AS(dsl::setAttr(none, GRB_DoubleAttr_LB, wrong), std::runtime_error);
+}
+
+// ============================================================================
+// SECTION R: GROUPING INDEXEDVARIABLESET ENTRIES
+// ============================================================================
+
+/**
+ * @test GroupBy::IndexedVariableSetEntries
+ * @brief Verifies group_by<Dim> over an IndexedVariableSet yields its entries
+ *
+ * @scenario Sparse assignment variables grouped per row and per column
+ * @given X(i,j) for (i + j) % 3 != 0 over 0..5 x 0..5
+ * @when Grouping entries by index[0] and index[1]
+ * @then Each slice references exactly the matching stored variables, in order
+ *
+ * @covers dsl::group_by(IndexedVariableSet), dsl::GroupIndex::operator[]
+ */
+TEST_CASE("R1: GroupBy::IndexedVariableSetEntries", "[variables][group_by]")
+{
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 6);
+    auto X = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "X",
+        (I * I) | dsl::filter([](int i, int j) { return (i + j) % 3 != 0; }));
+
+    auto rows = dsl::group_by<0>(X);
+    auto cols = dsl::group_by<1>(X);
+    REQUIRE(rows.size() == X.size());
+
+    for (int v = 0; v < 6; ++v) {
+        std::vector<const GRBVar*> rowScan, colScan;
+        for (const auto& e : X) {
+            if (e.index[0] == v) rowScan.push_back(&e.var);
+            if (e.index[1] == v) colScan.push_back(&e.var);
+        }
+        std::vector<const GRBVar*> rowGot, colGot;
+        for (const auto& e : rows[v]) rowGot.push_back(&e.var);
+        for (const auto& e : cols[v]) colGot.push_back(&e.var);
+        REQUIRE(rowGot == rowScan);
+        REQUIRE(colGot == colScan);
+    }
+
+    for (const auto& e : rows[2]) {
+        REQUIRE(e.var.sameAs(X(e.index[0], e.index[1])));
+    }
+}
+
+// ============================================================================
+// SECTION S: INDEXEDVARIABLESET STRUCTURE-OF-ARRAYS STORAGE
+// ============================================================================
+
+/**
+ * @test IndexedStorage::EntryViewsOverPackedIndices
+ * @brief Verifies entries are views over the contiguous variable array and packed indices
+ *
+ * @scenario Sparse 2-D set iterated, indexed and mutated through Entry views
+ * @given X(i,j) for i != j over 0..3 x 0..3
+ * @when Reading all()[k], iterating begin()/end() and assigning through Entry::var
+ * @then Views alias flat() and the lookup keys; indices are spans of arity 2
+ *
+ * @covers IndexedVariableSet::Entry, IndexedVariableSet::all(), IndexedVariableSet::at(span)
+ */
+TEST_CASE("S1: IndexedStorage::EntryViewsOverPackedIndices", "[variables][indexed][storage]")
+{
+    static_assert(std::random_access_iterator<dsl::IndexedVariableSet::iterator>);
+    static_assert(std::random_access_iterator<dsl::IndexedVariableSet::const_iterator>);
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 4);
+    auto X = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 1, "X",
+        (I * I) | dsl::filter([](int i, int j) { return i != j; }));
+    model.update();
+
+    const auto entries = X.all();
+    REQUIRE(entries.size() == 12);
+    REQUIRE(entries.end() - entries.begin() == 12);
+
+    std::size_t k = 0;
+    for (const auto& e : X) {
+        REQUIRE(e.index.size() == 2);
+        REQUIRE(&e.var == &X.flat()[k]);
+        REQUIRE(&entries[k].var == &e.var);
+        REQUIRE(entries[k].index.data() == e.index.data());
+        REQUIRE(&X.at(e.index) == &e.var);
+        REQUIRE(X.try_get(e.index) == &e.var);
+        ++k;
+    }
+    REQUIRE(k == X.size());
+
+    // Indices are packed back to back (one block of size() * arity ints)
+    REQUIRE(entries[1].index.data() == entries[0].index.data() + 2);
+    REQUIRE(entries[3].index[0] == 1);
+    REQUIRE(entries[3].index[1] == 0);
+    REQUIRE(entries.begin()->var.sameAs(X(0, 1)));
+
+    // Mutable iteration writes through to the stored variable
+    const GRBVar y = X(3, 2);
+    auto it = X.begin() + 1;
+    (*it).var = y;
+    REQUIRE(X(0, 2).sameAs(y));
+    REQUIRE(X.flat()[1].sameAs(y));
+
+    std::array<int, 2> missing{ 2, 2 };
+    REQUIRE(X.try_get(std::span<const int>(missing)) == nullptr);
+    REQUIRE_THROWS_AS(X.at(std::span<const int>(missing)), std::out_of_range);
+}
+
+// ============================================================================
+// SECTION T: STATICALLY RANKED CONTAINERS
+// ============================================================================
+
+template<typename T, typename... I>
+concept CanAt = requires(T& t, I... i) { t.at(i...); };
+
+/**
+ * @test StaticRank::VarArrayFromVariableGroup
+ * @brief Verifies VarArray<N> mirrors a VariableGroup with array indices
+ *
+ * @scenario 3x4 binary group converted to VarArray<2> and back
+ * @given X = add(model, ..., "X", 3, 4)
+ * @when Converting (copy and move), indexing and traversing with forEach
+ * @then Same variables at every index; arity errors are compile-time,
+ *       rank errors in conversion throw std::invalid_argument
+ *
+ * @covers dsl::VarArray
+ */
+TEST_CASE("T1: StaticRank::VarArrayFromVariableGroup", "[variables][static_rank]")
+{
+    static_assert(CanAt<dsl::VarArray<2>, int, int>);
+    static_assert(!CanAt<dsl::VarArray<2>, int>);
+    static_assert(!CanAt<dsl::VarArray<2>, int, int, int>);
+    static_assert(dsl::VarArray<3>::rank() == 3);
+
+    GRBModel model = makeModel();
+    auto X = dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "X", 3, 4);
+    model.update();
+
+    dsl::VarArray<2> A(X);
+    REQUIRE(A.count() == 12);
+    REQUIRE(A.shape() == std::array<std::size_t, 2>{ 3, 4 });
+    REQUIRE(A.size<1>() == 4);
+    REQUIRE(A.model() == X.model());
+    REQUIRE(A(2, 3).sameAs(X(2, 3)));
+    REQUIRE(A.at(std::array<int, 2>{ 1, 2 }).sameAs(X(1, 2)));
+    REQUIRE_THROWS_AS(A(3, 0), std::out_of_range);
+    REQUIRE_THROWS_AS(A(0, -1), std::out_of_range);
+
+    int visited = 0;
+    A.forEach([&](GRBVar& v, const std::array<int, 2>& idx) {
+        REQUIRE(v.sameAs(X(idx[0], idx[1])));
+        ++visited;
+    });
+    REQUIRE(visited == 12);
+
+    auto G = static_cast<dsl::VariableGroup>(A);
+    REQUIRE(G.dimension() == 2);
+    REQUIRE(G(2, 1).sameAs(X(2, 1)));
+
+    dsl::VarArray<2> moved(std::move(G));
+    REQUIRE(moved(0, 3).sameAs(X(0, 3)));
+
+    REQUIRE_THROWS_AS(dsl::VarArray<3>(X), std::invalid_argument);
+    REQUIRE_THROWS_AS(dsl::VarArray<2>(std::vector<GRBVar>(5), { 2, 3 }), std::invalid_argument);
+}
+
+/**
+ * @test StaticRank::SparseVarsFromIndexedSet
+ * @brief Verifies SparseVars<N> mirrors an IndexedVariableSet with array indices
+ *
+ * @scenario Filtered 2-D set converted to SparseVars<2> and back
+ * @given Y(i,j) for i < j over 0..3 x 0..3
+ * @when Looking up, iterating and traversing with forEach
+ * @then Same variables per index; absent keys and wrong arity are reported
+ *
+ * @covers dsl::SparseVars
+ */
+TEST_CASE("T2: StaticRank::SparseVarsFromIndexedSet", "[variables][static_rank]")
+{
+    static_assert(CanAt<dsl::SparseVars<2>, int, int>);
+    static_assert(!CanAt<dsl::SparseVars<2>, int>);
+    static_assert(std::random_access_iterator<dsl::SparseVars<2>::const_iterator>);
+
+    GRBModel model = makeModel();
+    auto I = dsl::range(0, 4);
+    auto Y = dsl::VariableFactory::addIndexed(model, GRB_CONTINUOUS, 0, 1, "Y",
+        (I * I) | dsl::filter([](int i, int j) { return i < j; }));
+    model.update();
+
+    dsl::SparseVars<2> S(Y);
+    REQUIRE(S.size() == 6);
+    REQUIRE(S.denseLookup() == Y.denseLookup());
+    REQUIRE(S(1, 3).sameAs(Y(1, 3)));
+    REQUIRE(S.try_get(3, 1) == nullptr);
+    REQUIRE_THROWS_AS(S.at(2, 2), std::out_of_range);
+
+    std::size_t k = 0;
+    for (const auto& [var, idx] : S) {
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(idx)>, std::array<int, 2>>);
+        REQUIRE(var.sameAs(Y.flat()[k]));
+        REQUIRE(&S.at(idx) == &var);
+        ++k;
+    }
+    REQUIRE(k == 6);
+
+    int visited = 0;
+    S.forEach([&](const GRBVar& v, const std::array<int, 2>& idx) {
+        REQUIRE(idx[0] < idx[1]);
+        REQUIRE(v.sameAs(Y(idx[0], idx[1])));
+        ++visited;
+    });
+    REQUIRE(visited == 6);
+
+    auto back = static_cast<dsl::IndexedVariableSet>(S);
+    REQUIRE(back.size() == 6);
+    REQUIRE(back(0, 2).sameAs(Y(0, 2)));
+
+    dsl::SparseVars<2> moved(std::move(back));
+    REQUIRE(moved(2, 3).sameAs(Y(2, 3)));
+
+    REQUIRE_THROWS_AS(dsl::SparseVars<3>(Y), std::invalid_argument);
+    REQUIRE(dsl::SparseVars<3>(dsl::IndexedVariableSet{}).empty());
+}
+
+// ============================================================================
+// SECTION U: COLUMN REVERSE INDEX
+// ============================================================================
+
+/**
+ * @test ColumnIndex::LocateMapsColumnsToKeyAndTuple
+ * @brief Verifies VariableTable::locate() recovers key and index tuple per column
+ *
+ * @scenario Scalar, dense, sparse and empty slots plus an unregistered column
+ * @given V0 scalar, V1 2x3 dense, a stray variable, V2 sparse upper triangle, V4 dense 2
+ * @when indexColumns() after model.update(), then locate() on every column
+ * @then Each registered column maps to its container, flat position and tuple;
+ *       the stray and out-of-range columns give nullopt; a stale index or a
+ *       container replaced through get() throws
+ *
+ * @covers VariableTable::indexColumns, VariableTable::locate
+ */
+TEST_CASE("U1: ColumnIndex::LocateMapsColumnsToKeyAndTuple", "[variables][table][locate]")
+{
+    GRBModel model = makeModel();
+    dsl::VariableTable<LargeVars> vt;
+
+    vt.set(LargeVars::V0, dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "s"));
+    vt.set(LargeVars::V1, dsl::VariableFactory::add(model, GRB_CONTINUOUS, 0, 1, "X", 2, 3));
+    GRBVar stray = model.addVar(0, 1, 0, GRB_CONTINUOUS);
+    auto I = dsl::range(0, 3);
+    vt.set(LargeVars::V2, dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "Y",
+        (I * I) | dsl::filter([](int i, int j) { return i < j; })));
+    vt.set(LargeVars::V4, dsl::VariableFactory::add(model, GRB_INTEGER, 0, 5, "Z", 2));
+
+    REQUIRE_THROWS_AS(vt.locate(0), std::logic_error);
+    model.update();
+    vt.indexColumns();
+
+    auto loc = vt.locate(vt.var(LargeVars::V0).index());
+    REQUIRE(loc);
+    REQUIRE(loc->key == LargeVars::V0);
+    REQUIRE(loc->index.empty());
+
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            loc = vt.locate(vt.var(LargeVars::V1, i, j).index());
+            REQUIRE(loc);
+            REQUIRE(loc->key == LargeVars::V1);
+            REQUIRE(loc->position == static_cast<std::size_t>(i * 3 + j));
+            REQUIRE(loc->index == std::vector<int>{ i, j });
+        }
+    }
+
+    REQUIRE_FALSE(vt.locate(stray.index()));
+
+    const auto& Y = vt.get(LargeVars::V2).asIndexed();
+    for (const auto& e : Y.all()) {
+        loc = vt.locate(e.var.index());
+        REQUIRE(loc);
+        REQUIRE(loc->key == LargeVars::V2);
+        REQUIRE(std::ranges::equal(loc->index, e.index));
+        REQUIRE(Y.flat()[loc->position].sameAs(e.var));
+    }
+
+    loc = vt.locate(vt.var(LargeVars::V4, 1).index());
+    REQUIRE(loc);
+    REQUIRE(loc->key == LargeVars::V4);
+    REQUIRE(loc->index == std::vector<int>{ 1 });
+
+    REQUIRE_FALSE(vt.locate(-1));
+    REQUIRE_FALSE(vt.locate(model.get(GRB_IntAttr_NumVars)));
+
+    // Replacing a container in place through get() is detected
+    const int lastY = Y.flat().back().index();
+    vt.get(LargeVars::V2) = dsl::VariableFactory::addIndexed(model, GRB_BINARY, 0, 1, "Y2",
+        (I * I) | dsl::filter([](int i, int j) { return i == 0 && j == 1; }));
+    model.update();
+    REQUIRE_THROWS_AS(vt.locate(lastY), std::logic_error);
+    vt.indexColumns();
+    REQUIRE_FALSE(vt.locate(lastY));
+    loc = vt.locate(vt.get(LargeVars::V2).asIndexed().flat()[0].index());
+    REQUIRE(loc);
+    REQUIRE(loc->index == std::vector<int>{ 0, 1 });
+
+    vt.set(LargeVars::V3, dsl::VariableFactory::add(model, GRB_BINARY, 0, 1, "W"));
+    REQUIRE_THROWS_AS(vt.locate(0), std::logic_error);
+    REQUIRE_THROWS_AS(vt.indexColumns(), std::logic_error);  // W has no column before update()
+}